@@ -1,18 +1,109 @@
 #ifndef LOUIERIKSSON_ATHYG_HPP
 #define LOUIERIKSSON_ATHYG_HPP
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
-#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+/*
+ * Buffered reads are issued asynchronously using io_uring on Linux, where available. Define ATHYG_NO_IO_URING to read using a background thread instead.
+ */
+#if defined(__linux__) && !defined(ATHYG_NO_IO_URING) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		#include <sys/syscall.h>
+		#include <sys/uio.h>
+		#define ATHYG_IO_URING
+	#endif
+#endif
+
+/*
+ * Compressed input, detected from the leading bytes of each file. Support for each format is opt-in, as it requires linking a library.
+ * Define ATHYG_ENABLE_ZLIB to read gzip files (link with zlib), and ATHYG_ENABLE_ZSTD to read Zstandard files (link with libzstd).
+ */
+#if defined(ATHYG_ENABLE_ZLIB)
+	#include <zlib.h>
+#endif
+
+#if defined(ATHYG_ENABLE_ZSTD)
+	#include <zstd.h>
+#endif
+
+/*
+ * Instruction set used to scan CSV data, selected at compile time.
+ * Define ATHYG_NO_SIMD to force the portable scalar implementation.
+ */
+#if !defined(ATHYG_NO_SIMD)
+	#if defined(__AVX2__)
+		#include <immintrin.h>
+		#define ATHYG_SIMD_AVX2
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#include <emmintrin.h>
+		#define ATHYG_SIMD_SSE2
+	#elif defined(__aarch64__) || defined(_M_ARM64)
+		#include <arm_neon.h>
+		#define ATHYG_SIMD_NEON
+	#endif
+#endif
+
+/*
+ * NUMA-aware loading and replication of catalogues (see Options::numa and Replicated). Support is opt-in, as it requires linking a library.
+ * Define ATHYG_ENABLE_NUMA to schedule and place memory by NUMA node on Linux (link with libnuma). Otherwise, every machine is treated as a single node.
+ */
+#if defined(ATHYG_ENABLE_NUMA)
+	#include <numa.h>
+	#include <numaif.h>
+	#include <sched.h>
+#endif
+
 namespace LouiEriksson {
 	
 	/**
@@ -22,498 +113,9435 @@ namespace LouiEriksson {
 	 */
 	struct ATHYG final {
 	
-	private:
+		/** @brief Grants the benchmark suite (see benchmark/) access to internal utilities such as Split, TryParse and the Scanner. */
+		friend struct ATHYGBenchmark;
+		
+		/** @brief Grants the unit tests (see benchmark/Tests.cpp) access to internal utilities such as the Scanner. */
+		friend struct ATHYGTests;
+		
+	public:
+		
+		/** @brief The ratio of the circumference of a circle to its diameter, used to convert coordinates between hours, degrees and radians. */
+		static constexpr double s_Pi { 3.14159265358979323846 };
 		
 		/**
-		 * @fn static std::stringstream ReadAllText(const std::filesystem::path& _path)
-		 * @brief Reads the contents of a text file.
-		 * @param _path The path to the file.
-		 * @return A std::stringstream containing the contents of the file.
-		 * @throws std::runtime_error If the file path is invalid.
+		 * @enum Source
+		 * @brief Strategy used by Load to read ATHYG CSV files from disk.
+		 */
+		enum class Source : unsigned char {
+			Buffered, /**< @brief Read each file into memory before parsing it. */
+			Mapped    /**< @brief Memory-map each file and parse it in-place, without copying. */
+		};
+		
+		/**
+		 * @struct Statistics
+		 * @brief Timings and counts of the files parsed by Load, Stream or Export.
 		 *
-		 * This function reads the contents of a text file specified by the file path.
-		 * It returns the contents of the file as a std::stringstream object.
+		 * Tokenising, converting and constructing are timed on every thread that parses, then summed, so may exceed the elapsed time when parsing in parallel.
+		 * Reading, which overlaps with parsing, is the time spent waiting for file data, summed over the files read at the same time.
 		 *
-		 * If the file does not exist or if the file cannot be opened, an exception is thrown.
+		 * @note Requires ATHYG_ENABLE_STATISTICS to be defined.
+		 *
+		 * @see Options::statistics
 		 */
-		static std::stringstream ReadAllText(const std::filesystem::path& _path) {
-		
-			std::stringstream result;
+		struct Statistics final {
 			
-			if (exists(_path)) {
+			/** @brief The time spent waiting for files to be read, mapped or decompressed. */
+			std::chrono::nanoseconds read { 0 };
 			
-				std::fstream fs;
-				fs.open(_path, std::ios::in);
+			/** @brief The time spent splitting rows into fields. */
+			std::chrono::nanoseconds tokenise { 0 };
 			
-				if (fs.is_open()) {
-					result << fs.rdbuf();
-					fs.close();
+			/** @brief The time spent converting the fields of each row and constructing the star (or appending it to the catalogue). */
+			std::chrono::nanoseconds convert { 0 };
+			
+			/** @brief The time spent merging parsed chunks into the result, in order. */
+			std::chrono::nanoseconds construct { 0 };
+			
+			/** @brief The number of files parsed. */
+			uint64_t files { 0U };
+			
+			/** @brief The number of bytes of rows parsed, after decompression, excluding headers. */
+			uint64_t bytes { 0U };
+			
+			/** @brief The number of rows parsed, including rejected rows. */
+			uint64_t rows { 0U };
+			
+			/** @brief The number of rows discarded by the filter. */
+			uint64_t rejected { 0U };
+			
+			/** @brief The number of malformed rows discarded by the error policy. */
+			uint64_t malformed { 0U };
+			
+			/**
+			 * @brief The number of accepted rows without a value for each field, indexed by field.
+			 *
+			 * Fields not selected by the projection are not counted.
+			 */
+			std::vector<uint64_t> nulls;
+			
+			/**
+			 * @brief Adds the timings and counts of another parse.
+			 * @param[in] _other The statistics to add.
+			 * @return A reference to these statistics.
+			 */
+			Statistics& operator += (const Statistics& _other) {
+				
+				read      += _other.read;
+				tokenise  += _other.tokenise;
+				convert   += _other.convert;
+				construct += _other.construct;
+				files     += _other.files;
+				bytes     += _other.bytes;
+				rows      += _other.rows;
+				rejected  += _other.rejected;
+				malformed += _other.malformed;
+				
+				if (nulls.size() < _other.nulls.size()) {
+					nulls.resize(_other.nulls.size(), 0U);
 				}
+				
+				for (size_t i = 0U; i < _other.nulls.size(); ++i) {
+					nulls[i] += _other.nulls[i];
+				}
+				
+				return *this;
 			}
-			else {
-				throw std::runtime_error("Invalid file path");
-			}
+		};
 		
-			return result;
-		}
+		/**
+		 * @struct Diagnostic
+		 * @brief Locates a malformed row of an ATHYG CSV file.
+		 */
+		struct Diagnostic final {
+			
+			/** @brief The path to the file. */
+			std::filesystem::path path;
+			
+			/** @brief The line number of the row, counting from 1 for the header. */
+			uint64_t line;
+			
+			/** @brief The offset of the start of the row from the start of the file in bytes, after decompression. */
+			uint64_t offset;
+			
+			/** @brief Why the row is malformed. */
+			std::string_view reason;
+		};
 		
 		/**
-		 * @brief Splits a string into a vector of substrings based on a delimiter.
+		 * @struct Diagnostics
+		 * @brief Counts the malformed rows discarded by Load, Stream or Export, and records the first of them.
 		 *
-		 * The provided string is split into substrings using the specified delimiter.
-		 * The substrings are then stored in a vector and returned.
-		 * If the template argument is std::string, the substrings are stored as std::string objects.
-		 * If the template argument is std::string_view, the substrings are stored as std::string_view objects.
+		 * @see Errors
+		 * @see Options::diagnostics
+		 */
+		struct Diagnostics final {
+			
+			/** @brief The maximum number of malformed rows to record. Rows beyond it are only counted. */
+			size_t capacity { 100U };
+			
+			/** @brief The number of malformed rows discarded, including those not recorded. */
+			uint64_t count { 0U };
+			
+			/** @brief The malformed rows recorded, in file order, then row order. */
+			std::vector<Diagnostic> entries;
+		};
+		
+		/**
+		 * @struct Options
+		 * @brief Configures how Load reads and parses ATHYG CSV files.
+		 */
+		struct Options final {
+			
+			/** @brief The strategy used to read each file. */
+			Source source { Source::Buffered };
+			
+			/**
+			 * @brief The number of threads used to parse the files.
+			 *
+			 * A value of 0 uses all hardware threads. A value of 1 parses every file serially on the calling thread.
+			 * When loading several files, up to this many files are read and parsed at the same time, each by an equal share of the threads.
+			 */
+			size_t threads { 1U };
+			
+			/**
+			 * @brief The approximate number of bytes parsed by each worker at a time.
+			 *
+			 * Large files are split into newline-aligned chunks of roughly this size so that a single file can be parsed by several threads.
+			 */
+			size_t chunk_size { 4U * 1024U * 1024U };
+			
+			/**
+			 * @brief (optional) The statistics to add the timings and counts of the parse to. Nothing is collected if null.
+			 *
+			 * @note Requires ATHYG_ENABLE_STATISTICS to be defined, otherwise Load, Stream and Export throw if it is not null.
+			 */
+			Statistics* statistics { nullptr };
+			
+			/**
+			 * @brief (optional) The diagnostics to add the malformed rows of the files to, when parsing with the Skip or Collect error policy.
+			 *
+			 * Under Skip, malformed rows are only counted. Under Collect, each is also recorded, up to the capacity of the diagnostics.
+			 * Ignored under Throw, and if null.
+			 *
+			 * @see Errors
+			 */
+			Diagnostics* diagnostics { nullptr };
+			
+			/**
+			 * @brief Whether to schedule the parse and place the result by NUMA node.
+			 *
+			 * Chunks are divided between the nodes in file order, and each is parsed by a thread running on its node, which is first to touch the memory of the chunk.
+			 * The columns of a Catalogue are spread evenly across the nodes, so that each partition of its rows (see Catalogue::Partition) is local to one node.
+			 * Memory is placed before it is first touched where the result is sized exactly upfront, i.e. when loading a single mapped file, and migrated otherwise.
+			 *
+			 * @note Has no effect unless ATHYG_ENABLE_NUMA is defined and the machine has more than one node.
+			 *
+			 * @see Replicated
+			 */
+			bool numa { false };
+		};
+		
+		/**
+		 * @struct Symbol
+		 * @brief Marks a low-cardinality text field, such as a constellation abbreviation or source tag.
 		 *
-		 * @param[in] _string The string to split.
-		 * @param[in] _divider The delimiter character to split the string by.
-		 * @param[in] _capacity (optional) The initial capacity of the result vector. Defaults to 0.
+		 * Records parse symbols as std::string, whereas the Catalogue stores them dictionary-encoded.
 		 *
-		 * @tparam T The type of the resulting substrings. Must be either std::string or std::string_view.
+		 * @see SymbolColumn
+		 */
+		struct Symbol final {};
+		
+		/**
+		 * @struct Descriptor
+		 * @brief Compile-time description of one field of an ATHYG version: its column index, its name in the header, the type it is parsed as, and the member of the record it is parsed into.
 		 *
-		 * @return std::vector<T> A vector containing the substrings.
+		 * Each version describes its fields with a tuple of descriptors, s_Schema, ordered by column index.
+		 * The field count, header names and parsed types of the version, the constructor of its records, and the columns, projection masks and
+		 * binary cache layout of its Catalogue are all generated from the schema.
 		 *
-		 * @note The function assumes that the provided delimiter is a single character.
-		 * @note If _capacity is specified, the internal vector capacity is set to that value.
-		 * @note The last word of the string is always included in the result, even if it is not delimited.
-		 * @note The function assumes that the template argument is std::string or std::string_view.
+		 * The members of the record and its Field enum are still declared by hand, since they cannot be generated without reflection, but the schema is checked
+		 * against both: the member must be an optional of the parsed type, and the field of each descriptor must equal its position in the schema.
+		 *
+		 * @tparam R The record type of the version.
+		 * @tparam U The type the field is parsed as: an arithmetic type, std::string, or Symbol.
 		 */
-		template<typename T = std::string_view>
-		static constexpr std::vector<T> Split(const std::string_view& _string, const char& _divider, const size_t& _capacity = 0U) {
+		template <typename R, typename U>
+		struct Descriptor final {
 			
-			static_assert(std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>,
-                  "Template argument must be std::string or std::string_view");
-    
-			std::vector<T> result;
-			result.reserve(_capacity);
+			/** @brief The type the field is parsed as. */
+			using Type = U;
 			
-			// Boost library version of string splitting.
-			// (https://www.boost.org/doc/libs/1_54_0/doc/html/string_algo/usage.html#idp166856528)
-			std::string::size_type start = 0U;
-			std::string::size_type end = 0U;
+			/** @brief The type of the value of the field in a record, which is std::string for symbols. */
+			using Value = std::conditional_t<std::is_same_v<U, Symbol>, std::string, U>;
 			
-			while((end = _string.find(_divider, start)) != std::string::npos) {
-			    result.emplace_back(_string.substr(start, end - start));
-			    start = end + 1U;
-			}
+			/** @brief The field, valued by its column index. */
+			typename R::Field field;
 			
-			// Last word is not delimited.
-			result.emplace_back(_string.substr(start));
+			/** @brief The name of the field in the header of the CSV file. */
+			std::string_view name;
 			
-			return result;
-		}
+			/** @brief The member of the record holding the value of the field. */
+			std::optional<Value> R::* member;
+		};
+		
+		/**
+		 * @enum Missing
+		 * @brief Policy used by Export for fields without a value.
+		 */
+		enum class Missing : unsigned char {
+			Zero, /**< @brief Write zero in place of the field.                        */
+			NaN,  /**< @brief Write a quiet NaN in place of the field.                 */
+			Skip  /**< @brief Do not write a vertex for a star which is missing a field. */
+		};
+		
+		/**
+		 * @enum Errors
+		 * @brief Policy used by Load, Stream and Export for malformed rows, which have fewer fields than the header. Chosen at compile time.
+		 *
+		 * @code
+		 * ATHYG::Diagnostics diagnostics;
+		 *
+		 * ATHYG::Options options;
+		 * options.diagnostics = &diagnostics;
+		 *
+		 * const auto stars = ATHYG::Load<ATHYG::V3, ATHYG::Projection<ATHYG::V3>, ATHYG::Errors::Collect>(paths, options);
+		 *
+		 * for (const auto& entry : diagnostics.entries) {
+		 *     std::cerr << entry.path << ':' << entry.line << ": " << entry.reason << '\n';
+		 * }
+		 * @endcode
+		 *
+		 * @see Diagnostics
+		 */
+		enum class Errors : unsigned char {
+			Throw,  /**< @brief Throw a std::runtime_error, abandoning the load.                 */
+			Skip,   /**< @brief Discard the row, and count it in Options::diagnostics.            */
+			Collect /**< @brief Discard the row, and count and record it in Options::diagnostics. */
+		};
+		
+	private:
 		
 		/**
-		 * @brief Converts an std::vector to an std::array of a specified size using move semantics.
+		 * @fn static std::string ReadAllText(const std::filesystem::path& _path)
+		 * @brief Reads the contents of a text file.
+		 * @param _path The path to the file.
+		 * @return A std::string containing the contents of the file.
+		 * @throws std::runtime_error If the file path is invalid.
 		 *
-		 * This function takes an std::vector and converts its elements to an std::array
-		 * of a specified size. It throws an std::runtime_error if the size of the vector
-		 * does not match the size of the array.
+		 * This function reads the contents of a text file specified by the file path.
+		 * It returns the contents of the file as a std::string, read in a single pass with no intermediate buffers.
 		 *
-		 * @tparam _Tp The type of elements in the vector and array.
-		 * @tparam _Nm The size of the array.
-		 * @param[in,out] _vector The vector to be converted.
-		 * @return The resulting array.
-		 * @throws std::runtime_error if the size of the vector does not match the size of the array.
+		 * If the file does not exist or if the file cannot be opened, an exception is thrown.
 		 */
-		template<typename _Tp, size_t _Nm>
-		static constexpr std::array<_Tp, _Nm> ToArray(const std::vector<_Tp>&& _vector) {
+		static std::string ReadAllText(const std::filesystem::path& _path) {
 			
-			if (_vector.size() != _Nm) {
-				
-				Debug::Log("Vector -> Array size mismatch! (" + std::to_string(_vector.size()) + ", " + std::to_string(_Nm) + ")");
-				
-				throw std::runtime_error("Vector -> Array size mismatch!");
-			}
+			std::string result;
+			
+			if (exists(_path)) {
 			
-			std::array<_Tp, _Nm> result;
-			std::move(
-			    _vector.begin(),
-			    _vector.begin() + std::min(_vector.size(), result.size()),
-			     result.begin()
-			);
+				std::ifstream fs;
+				fs.open(_path, std::ios::in | std::ios::binary);
 			
+				if (fs.is_open()) {
+					
+					result.resize(static_cast<size_t>(file_size(_path)));
+					
+					fs.read(result.data(), static_cast<std::streamsize>(result.size()));
+					result.resize(static_cast<size_t>(fs.gcount()));
+					
+					fs.close();
+				}
+			}
+			else {
+				throw std::runtime_error("Invalid file path");
+			}
+		
 			return result;
 		}
 		
 		/**
-		 * @brief Attempts to parse a string into an optional value of type T.
+		 * @class MappedFile
+		 * @brief Read-only memory mapping of a file.
 		 *
-		 * This function attempts to convert the given string into a value of type T.
-		 * If the conversion is successful, the resulting value is wrapped in an optional object and returned.
-		 * If the conversion fails, an empty optional object is returned.
-		 *
-		 * @tparam T The type of value to parse the string into.
-		 * @param[in] _str The string to parse.
-		 * @return An optional value of type T, containing the parsed value if the conversion is successful, or an empty optional if the conversion fails.
+		 * Maps the entire file into the address space of the process using mmap (POSIX) or MapViewOfFile (Windows).
+		 * The mapped bytes are exposed as a std::string_view, allowing them to be tokenised in-place without copying.
+		 * The mapping is released when the object is destroyed.
 		 *
-		 * @note The type T must provide a specialize definition of this function in order to support parsing for that type.
+		 * @note Empty files are not mapped, and produce an empty view.
 		 */
-		template <typename T>
-		static std::optional<T> TryParse(const std::string_view& _str) noexcept {
+		class MappedFile final {
+		
+			const char* m_Data;
+			size_t      m_Size;
 			
-			T r;
+		#if defined(_WIN32)
+			HANDLE m_File;
+			HANDLE m_Mapping;
+		#endif
 			
-		    char* e          = nullptr; // (end)
-			constexpr auto b = 10;      // (base)
+			void Release() noexcept {
+			
+			#if defined(_WIN32)
+				if (m_Data    != nullptr)              { UnmapViewOfFile(m_Data); }
+				if (m_Mapping != nullptr)              { CloseHandle(m_Mapping);  }
+				if (m_File    != INVALID_HANDLE_VALUE) { CloseHandle(m_File);     }
+				
+				m_Mapping = nullptr;
+				m_File    = INVALID_HANDLE_VALUE;
+			#else
+				if (m_Data != nullptr) {
+					munmap(const_cast<char*>(m_Data), m_Size);
+				}
+			#endif
+				
+				m_Data = nullptr;
+				m_Size = 0U;
+			}
 			
-			try {
-				
-				     if constexpr (std::is_same_v<T, int                >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, short              >) { r = static_cast<T>(std::strtol  (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, long               >) { r =                std::strtol  (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, long long          >) { r =                std::strtoll (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, unsigned int       >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, unsigned short     >) { r = static_cast<T>(std::strtoul (_str.data(), &e, b)); }
-				else if constexpr (std::is_same_v<T, unsigned long      >) { r =                std::strtoul (_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, unsigned long long >) { r =                std::strtoull(_str.data(), &e, b ); }
-				else if constexpr (std::is_same_v<T, float              >) { r =                std::strtof  (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, double             >) { r =                std::strtod  (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, long double        >) { r =                std::strtold (_str.data(), &e    ); }
-				else if constexpr (std::is_same_v<T, char         > ||
-				                   std::is_same_v<T, unsigned char> ||
-								   std::is_same_v<T, signed char  > ||
-						           std::is_same_v<T, char16_t     > ||
-				                   std::is_same_v<T, char32_t     > ||
-		                           std::is_same_v<T, wchar_t      >)
-			    {
-					if (!_str.empty()) {
-			            r = static_cast<T>(_str[0U]);
+		public:
+			
+			/**
+			 * @brief Maps the file at the given path.
+			 * @param[in] _path The path to the file.
+			 * @throws std::runtime_error If the file cannot be opened or mapped.
+			 */
+			explicit MappedFile(const std::filesystem::path& _path) :
+				m_Data(nullptr),
+				m_Size(0U)
+			#if defined(_WIN32)
+				, m_File(INVALID_HANDLE_VALUE),
+				m_Mapping(nullptr)
+			#endif
+			{
+			#if defined(_WIN32)
+				m_File = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				
+				if (m_File == INVALID_HANDLE_VALUE) {
+					throw std::runtime_error("Failed to open \"" + _path.string() + "\"");
+				}
+				
+				LARGE_INTEGER size;
+				if (GetFileSizeEx(m_File, &size) == 0) {
+					Release();
+					throw std::runtime_error("Failed to query size of \"" + _path.string() + "\"");
+				}
+				
+				m_Size = static_cast<size_t>(size.QuadPart);
+				
+				if (m_Size > 0U) {
+					
+					m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					
+					if (m_Mapping != nullptr) {
+						m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
 					}
-					else {
-						e = const_cast<char*>(_str.data());
+					
+					if (m_Data == nullptr) {
+						Release();
+						throw std::runtime_error("Failed to map \"" + _path.string() + "\"");
 					}
 				}
-				else if constexpr (std::is_same_v<T, bool>) {
-			        r = _str == "true" || _str == "True" || _str == "TRUE" || _str == "T" || _str == "1";
+			#else
+				const int fd = open(_path.c_str(), O_RDONLY);
+				
+				if (fd == -1) {
+					throw std::runtime_error("Failed to open \"" + _path.string() + "\"");
 				}
-				else {
-					static_assert([]{ return false; }(), "No specialisation exists for parsing string to T");
+				
+				struct stat info {};
+				if (fstat(fd, &info) == -1) {
+					close(fd);
+					throw std::runtime_error("Failed to query size of \"" + _path.string() + "\"");
 				}
+				
+				m_Size = static_cast<size_t>(info.st_size);
+				
+				if (m_Size > 0U) {
+					
+					void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+					
+					if (data == MAP_FAILED) {
+						close(fd);
+						m_Size = 0U;
+						throw std::runtime_error("Failed to map \"" + _path.string() + "\"");
+					}
+					
+					// The file is tokenised front-to-back, so request aggressive read-ahead.
+					madvise(data, m_Size, MADV_SEQUENTIAL);
+					
+					m_Data = static_cast<const char*>(data);
+				}
+				
+				// The mapping remains valid after the descriptor is closed.
+				close(fd);
+			#endif
 			}
-			catch (const std::exception& err) {
+			
+			MappedFile(const MappedFile&)            = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+			
+			MappedFile(MappedFile&& _other) noexcept :
+				m_Data(_other.m_Data),
+				m_Size(_other.m_Size)
+			#if defined(_WIN32)
+				, m_File(_other.m_File),
+				m_Mapping(_other.m_Mapping)
+			#endif
+			{
+				_other.m_Data = nullptr;
+				_other.m_Size = 0U;
 				
-				/* Shouldn't ever happen but catch anyway... */
+			#if defined(_WIN32)
+				_other.m_File    = INVALID_HANDLE_VALUE;
+				_other.m_Mapping = nullptr;
+			#endif
+			}
+			
+			MappedFile& operator=(MappedFile&& _other) noexcept {
 				
-				e = const_cast<char*>(_str.data());
+				if (this != &_other) {
+					
+					Release();
+					
+					std::swap(m_Data, _other.m_Data);
+					std::swap(m_Size, _other.m_Size);
+					
+				#if defined(_WIN32)
+					std::swap(m_File,    _other.m_File);
+					std::swap(m_Mapping, _other.m_Mapping);
+				#endif
+				}
 				
-				std::cerr << err.what() << std::endl;
+				return *this;
 			}
 			
-			return (e == _str.data()) ?
-		        std::optional<T>(std::nullopt) :
-				std::optional<T>(r);
-		}
-		
-		template<>
-		[[deprecated("Redundant operation: string_view to string conversion is not necessary.")]]
-		inline std::optional<std::string> Utils::TryParse(const std::string_view& _str) noexcept {
-			return std::string(_str);
-		}
-		
-		template<>
-		[[deprecated("Redundant operation: string_view to string_view conversion is not necessary.")]]
-		inline std::optional<std::string_view> Utils::TryParse(const std::string_view& _str) noexcept {
-			return _str;
-		}
-		
-	public:
-		
-		/**
-		 * @struct V1
-		 * @brief Utility for deserialising version 1 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
-		 *
-		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
-		 */
-		struct [[maybe_unused]] V1 final {
+			~MappedFile() {
+				Release();
+			}
 			
-			[[maybe_unused]] const std::optional<const size_t>      id;
-			[[maybe_unused]] const std::optional<const std::string> tyc;
-			[[maybe_unused]] const std::optional<const size_t>      gaia;
-			[[maybe_unused]] const std::optional<const size_t>      hyg;
-			[[maybe_unused]] const std::optional<const size_t>      hip;
-			[[maybe_unused]] const std::optional<const size_t>      hd;
-			[[maybe_unused]] const std::optional<const size_t>      hr;
-			[[maybe_unused]] const std::optional<const std::string> gl;
-			[[maybe_unused]] const std::optional<const std::string> bayer;
-			[[maybe_unused]] const std::optional<const std::string> flam;
-			[[maybe_unused]] const std::optional<const std::string> con;
-			[[maybe_unused]] const std::optional<const std::string> proper;
-			[[maybe_unused]] const std::optional<const double>      ra;
-			[[maybe_unused]] const std::optional<const double>      dec;
-			[[maybe_unused]] const std::optional<const std::string> pos_src;
-			[[maybe_unused]] const std::optional<const double>      dist;
-			[[maybe_unused]] const std::optional<const double>      x0;
-			[[maybe_unused]] const std::optional<const double>      y0;
-			[[maybe_unused]] const std::optional<const double>      z0;
-			[[maybe_unused]] const std::optional<const std::string> dist_src;
-			[[maybe_unused]] const std::optional<const double>      mag;
-			[[maybe_unused]] const std::optional<const double>      absmag;
-			[[maybe_unused]] const std::optional<const std::string> mag_src;
-			
-			[[maybe_unused]] static constexpr size_t s_ElementCount { 23U };
-			
-			template <typename T>
-			explicit V1(const std::array<T, s_ElementCount>& _values) noexcept :
-				id      (TryParse<size_t>(_values[ 0U])),
-				tyc     (                 _values[ 1U] ),
-				gaia    (TryParse<size_t>(_values[ 2U])),
-				hyg     (TryParse<size_t>(_values[ 3U])),
-				hip     (TryParse<size_t>(_values[ 4U])),
-				hd      (TryParse<size_t>(_values[ 5U])),
-				hr      (TryParse<size_t>(_values[ 6U])),
-				gl      (                 _values[ 7U] ),
-				bayer   (                 _values[ 8U] ),
-				flam    (                 _values[ 9U] ),
-				con     (                 _values[10U] ),
-				proper  (                 _values[11U] ),
-				ra      (TryParse<double>(_values[12U])),
-				dec     (TryParse<double>(_values[13U])),
-				pos_src (                 _values[14U] ),
-				dist    (TryParse<double>(_values[15U])),
-				x0      (TryParse<double>(_values[16U])),
-				y0      (TryParse<double>(_values[17U])),
-				z0      (TryParse<double>(_values[18U])),
-				dist_src(                 _values[19U] ),
-				mag     (TryParse<double>(_values[20U])),
-				absmag  (TryParse<double>(_values[21U])),
-				mag_src (                 _values[22U]) {}
+			/**
+			 * @brief Returns a view over the mapped bytes.
+			 * @return A std::string_view spanning the entire file.
+			 */
+			[[nodiscard]] std::string_view View() const noexcept {
+				return { m_Data, m_Size };
+			}
 		};
 		
 		/**
-		 * @struct V2
-		 * @brief Utility for deserialising version 2 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
-		 *
-		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
+		 * @brief The compression formats of input files.
 		 */
-		struct [[maybe_unused]] V2 final {
-		
-			[[maybe_unused]] const std::optional<const size_t>      id;
-			[[maybe_unused]] const std::optional<const std::string> tyc;
-			[[maybe_unused]] const std::optional<const size_t>      gaia;
-			[[maybe_unused]] const std::optional<const size_t>      hyg;
-			[[maybe_unused]] const std::optional<const size_t>      hip;
-			[[maybe_unused]] const std::optional<const size_t>      hd;
-			[[maybe_unused]] const std::optional<const size_t>      hr;
-			[[maybe_unused]] const std::optional<const std::string> gl;
-			[[maybe_unused]] const std::optional<const std::string> bayer;
-			[[maybe_unused]] const std::optional<const std::string> flam;
-			[[maybe_unused]] const std::optional<const std::string> con;
-			[[maybe_unused]] const std::optional<const std::string> proper;
-			[[maybe_unused]] const std::optional<const double>      ra;
-			[[maybe_unused]] const std::optional<const double>      dec;
-			[[maybe_unused]] const std::optional<const std::string> pos_src;
-			[[maybe_unused]] const std::optional<const double>      dist;
-			[[maybe_unused]] const std::optional<const double>      x0;
-			[[maybe_unused]] const std::optional<const double>      y0;
-			[[maybe_unused]] const std::optional<const double>      z0;
-			[[maybe_unused]] const std::optional<const std::string> dist_src;
-			[[maybe_unused]] const std::optional<const double>      mag;
-			[[maybe_unused]] const std::optional<const double>      absmag;
-			[[maybe_unused]] const std::optional<const std::string> mag_src;
-			[[maybe_unused]] const std::optional<const double>      rv;
-			[[maybe_unused]] const std::optional<const std::string> rv_src;
-			[[maybe_unused]] const std::optional<const double>      pm_ra;
-			[[maybe_unused]] const std::optional<const double>      pm_dec;
-			[[maybe_unused]] const std::optional<const double>      pm_src;
-			[[maybe_unused]] const std::optional<const double>      vx;
-			[[maybe_unused]] const std::optional<const double>      vy;
-			[[maybe_unused]] const std::optional<const double>      vz;
-			[[maybe_unused]] const std::optional<const double>      spect;
-			[[maybe_unused]] const std::optional<const std::string> spect_src;
-			
-			[[maybe_unused]] static constexpr size_t s_ElementCount { 33U };
-			
-			template <typename T>
-			explicit V2(const std::array<T, s_ElementCount>& _values) noexcept :
-				id       (TryParse<size_t>(_values[ 0U])),
-				tyc      (                 _values[ 1U] ),
-				gaia     (TryParse<size_t>(_values[ 2U])),
-				hyg      (TryParse<size_t>(_values[ 3U])),
-				hip      (TryParse<size_t>(_values[ 4U])),
-				hd       (TryParse<size_t>(_values[ 5U])),
-				hr       (TryParse<size_t>(_values[ 6U])),
-				gl       (                 _values[ 7U] ),
-				bayer    (                 _values[ 8U] ),
-				flam     (                 _values[ 9U] ),
-				con      (                 _values[10U] ),
-				proper   (                 _values[11U] ),
-				ra       (TryParse<double>(_values[12U])),
-				dec      (TryParse<double>(_values[13U])),
-				pos_src  (                 _values[14U] ),
-				dist     (TryParse<double>(_values[15U])),
-				x0       (TryParse<double>(_values[16U])),
-				y0       (TryParse<double>(_values[17U])),
-				z0       (TryParse<double>(_values[18U])),
-				dist_src (                 _values[19U] ),
-				mag      (TryParse<double>(_values[20U])),
-				absmag   (TryParse<double>(_values[21U])),
-				mag_src  (                 _values[22U] ),
-				rv       (TryParse<double>(_values[23U])),
-				rv_src   (                 _values[24U] ),
-				pm_ra    (TryParse<double>(_values[25U])),
-				pm_dec   (TryParse<double>(_values[26U])),
-				pm_src   (TryParse<double>(_values[27U])),
-				vx       (TryParse<double>(_values[28U])),
-				vy       (TryParse<double>(_values[29U])),
-				vz       (TryParse<double>(_values[30U])),
-				spect    (TryParse<double>(_values[31U])),
-				spect_src(                 _values[32U]) {}
+		enum class Compression : unsigned char {
+			None, /**< @brief Uncompressed text. */
+			Gzip, /**< @brief gzip (RFC 1952), possibly consisting of multiple concatenated members. */
+			Zstd, /**< @brief Zstandard, possibly consisting of multiple concatenated frames. */
 		};
 		
 		/**
-		 * @struct V3
-		 * @brief Utility for deserialising version 3 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
-		 *
-		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
+		 * @brief Detects the compression format of a file from its leading bytes.
+		 * @param[in] _path The path to the file.
+		 * @return The compression format of the file.
 		 */
-		struct [[maybe_unused]] V3 final {
+		static Compression Detect(const std::filesystem::path& _path) {
 			
-			[[maybe_unused]] const std::optional<const size_t>      id;
-			[[maybe_unused]] const std::optional<const std::string> tyc;
-			[[maybe_unused]] const std::optional<const size_t>      gaia;
-			[[maybe_unused]] const std::optional<const size_t>      hyg;
-			[[maybe_unused]] const std::optional<const size_t>      hip;
-			[[maybe_unused]] const std::optional<const size_t>      hd;
-			[[maybe_unused]] const std::optional<const size_t>      hr;
-			[[maybe_unused]] const std::optional<const std::string> gl;
-			[[maybe_unused]] const std::optional<const std::string> bayer;
-			[[maybe_unused]] const std::optional<const std::string> flam;
-			[[maybe_unused]] const std::optional<const std::string> con;
-			[[maybe_unused]] const std::optional<const std::string> proper;
-			[[maybe_unused]] const std::optional<const double>      ra;
-			[[maybe_unused]] const std::optional<const double>      dec;
-			[[maybe_unused]] const std::optional<const std::string> pos_src;
-			[[maybe_unused]] const std::optional<const double>      dist;
-			[[maybe_unused]] const std::optional<const double>      x0;
-			[[maybe_unused]] const std::optional<const double>      y0;
-			[[maybe_unused]] const std::optional<const double>      z0;
-			[[maybe_unused]] const std::optional<const std::string> dist_src;
-			[[maybe_unused]] const std::optional<const double>      mag;
-			[[maybe_unused]] const std::optional<const double>      absmag;
-			[[maybe_unused]] const std::optional<const double>      ci;
-			[[maybe_unused]] const std::optional<const std::string> mag_src;
-			[[maybe_unused]] const std::optional<const double>      rv;
-			[[maybe_unused]] const std::optional<const std::string> rv_src;
-			[[maybe_unused]] const std::optional<const double>      pm_ra;
-			[[maybe_unused]] const std::optional<const double>      pm_dec;
-			[[maybe_unused]] const std::optional<const double>      pm_src;
-			[[maybe_unused]] const std::optional<const double>      vx;
-			[[maybe_unused]] const std::optional<const double>      vy;
-			[[maybe_unused]] const std::optional<const double>      vz;
-			[[maybe_unused]] const std::optional<const double>      spect;
-			[[maybe_unused]] const std::optional<const std::string> spect_src;
-			
-			[[maybe_unused]] static constexpr size_t s_ElementCount { 34U };
-			
-			template <typename T>
-			explicit V3(const std::array<T, s_ElementCount>& _values) noexcept :
-				id       (TryParse<size_t>(_values[ 0U])),
-				tyc      (                 _values[ 1U] ),
-				gaia     (TryParse<size_t>(_values[ 2U])),
-				hyg      (TryParse<size_t>(_values[ 3U])),
-				hip      (TryParse<size_t>(_values[ 4U])),
-				hd       (TryParse<size_t>(_values[ 5U])),
-				hr       (TryParse<size_t>(_values[ 6U])),
-				gl       (                 _values[ 7U] ),
-				bayer    (                 _values[ 8U] ),
-				flam     (                 _values[ 9U] ),
-				con      (                 _values[10U] ),
-				proper   (                 _values[11U] ),
-				ra       (TryParse<double>(_values[12U])),
-				dec      (TryParse<double>(_values[13U])),
-				pos_src  (                 _values[14U] ),
-				dist     (TryParse<double>(_values[15U])),
-				x0       (TryParse<double>(_values[16U])),
-				y0       (TryParse<double>(_values[17U])),
-				z0       (TryParse<double>(_values[18U])),
-				dist_src (                 _values[19U] ),
-				mag      (TryParse<double>(_values[20U])),
-				absmag   (TryParse<double>(_values[21U])),
-				ci       (TryParse<double>(_values[22U])),
-				mag_src  (                 _values[23U] ),
-				rv       (TryParse<double>(_values[24U])),
-				rv_src   (                 _values[25U] ),
-				pm_ra    (TryParse<double>(_values[26U])),
-				pm_dec   (TryParse<double>(_values[27U])),
-				pm_src   (TryParse<double>(_values[28U])),
-				vx       (TryParse<double>(_values[29U])),
-				vy       (TryParse<double>(_values[30U])),
-				vz       (TryParse<double>(_values[31U])),
-				spect    (TryParse<double>(_values[32U])),
-				spect_src(                 _values[33U] ) {}
-		};
+			std::array<unsigned char, 4U> magic {};
+			
+			std::ifstream fs(_path, std::ios::in | std::ios::binary);
+			fs.read(reinterpret_cast<char*>(magic.data()), static_cast<std::streamsize>(magic.size()));
+			
+			const auto count = static_cast<size_t>(fs.gcount());
+			
+			if (count >= 2U && magic[0] == 0x1FU && magic[1] == 0x8BU) {
+				return Compression::Gzip;
+			}
+			
+			if (count >= 4U && magic[0] == 0x28U && magic[1] == 0xB5U && magic[2] == 0x2FU && magic[3] == 0xFDU) {
+				return Compression::Zstd;
+			}
+			
+			return Compression::None;
+		}
 		
 		/**
-		 * @brief Load and parse ATHYG dataset files.
-		 *
-		 * This function loads and parses ATHYG CSV files.
-		 * The template argument must be one of the ATHYG dataset versions:
-		 * V1, V2, or V3.
+		 * @class Decompressor
+		 * @brief Incrementally decompresses a gzip or Zstandard file.
 		 *
-		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
-		 * @return A vector containing the deserialized data of type T.
-		 * @throw std::runtime_error If the number of elements in a CSV line
-		 * is not consistent with the ATHYG version.
-		 * @throw std::runtime_error If the specified path is not valid.
+		 * The compressed file is read in fixed-size blocks, so only a small window of it is held in memory at a time.
 		 *
-		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @note Requires ATHYG_ENABLE_ZLIB (gzip) or ATHYG_ENABLE_ZSTD (Zstandard) to be defined.
 		 */
-		template <typename T>
-		static std::vector<T> Load(const std::vector<std::filesystem::path>& _athyg_paths) {
+		class Decompressor final {
 			
-			static_assert(std::is_same_v<T, ATHYG::V1> || std::is_same_v<T, ATHYG::V2> || std::is_same_v<T, ATHYG::V3>,
-			        "Template argument must be an ATHYG version!");
+			static constexpr size_t s_InputSize { 1U << 18U };
 			
-			// Merged result
-			std::vector<T> result;
+			std::ifstream     m_Stream;
+			std::vector<char> m_Input;
 			
-			// Load and parse each file in parallel:
-			for (const auto& path : _athyg_paths) {
+			Compression m_Compression;
 			
-				std::cout << "Parsing \"" + path.string() + "\"... " << std::flush;
+			/** @brief Whether the end of the current gzip member or Zstandard frame has been reached. */
+			bool m_Complete;
 			
-				if (exists(path)) {
-					
-					auto csv = ReadAllText(path);
-					
-					std::string line;
-					
-					// Skip the header (first line) of the CSV.
-					std::getline(csv, line);
-					
-					// Process CSV elements:
-				    while (std::getline(csv, line)) {
-						
-						auto elements = Split(line, ',', T::s_ElementCount);
-						
-						// Discard elements beyond the count used by this ATHYG version.
-						if (elements.size() > T::s_ElementCount) {
-							elements.resize(T::s_ElementCount);
-						}
-						
-						// Validate number of elements matches the count expected by the ATHYG version.
-						if (elements.size() == T::s_ElementCount) {
+		#if defined(ATHYG_ENABLE_ZLIB)
+			z_stream m_Zlib;
+		#endif
+			
+		#if defined(ATHYG_ENABLE_ZSTD)
+			ZSTD_DStream*  m_Zstd;
+			ZSTD_inBuffer  m_ZstdInput;
+		#endif
+			
+			/**
+			 * @brief Reads the next block of the compressed file.
+			 * @return The number of bytes read, which is 0 at the end of the file.
+			 */
+			size_t Fill() {
+				
+				m_Stream.read(m_Input.data(), static_cast<std::streamsize>(m_Input.size()));
+				
+				return static_cast<size_t>(m_Stream.gcount());
+			}
+			
+		public:
+			
+			/**
+			 * @brief Opens a compressed file.
+			 * @param[in] _path The path to the file.
+			 * @param[in] _compression The compression format of the file.
+			 * @throws std::runtime_error If the file cannot be opened, or support for its format is not enabled.
+			 */
+			Decompressor(const std::filesystem::path& _path, const Compression& _compression) :
+				m_Stream(_path, std::ios::in | std::ios::binary),
+				m_Input(s_InputSize),
+				m_Compression(_compression),
+				m_Complete(false)
+			#if defined(ATHYG_ENABLE_ZLIB)
+				, m_Zlib()
+			#endif
+			#if defined(ATHYG_ENABLE_ZSTD)
+				, m_Zstd(nullptr)
+				, m_ZstdInput { m_Input.data(), 0U, 0U }
+			#endif
+			{
+				if (!m_Stream.is_open()) {
+					throw std::runtime_error("Invalid file path");
+				}
+				
+				if (m_Compression == Compression::Gzip) {
+					
+				#if defined(ATHYG_ENABLE_ZLIB)
+					
+					// A window of 15 bits, plus 16 to expect a gzip header.
+					if (inflateInit2(&m_Zlib, 15 + 16) != Z_OK) {
+						throw std::runtime_error("Failed to initialise zlib!");
+					}
+				#else
+					throw std::runtime_error("Reading gzip files requires ATHYG_ENABLE_ZLIB to be defined!");
+				#endif
+				}
+				else if (m_Compression == Compression::Zstd) {
+					
+				#if defined(ATHYG_ENABLE_ZSTD)
+					
+					m_Zstd = ZSTD_createDStream();
+					
+					if (m_Zstd == nullptr || ZSTD_isError(ZSTD_initDStream(m_Zstd)) != 0U) {
+						
+						ZSTD_freeDStream(m_Zstd);
+						
+						throw std::runtime_error("Failed to initialise libzstd!");
+					}
+				#else
+					throw std::runtime_error("Reading Zstandard files requires ATHYG_ENABLE_ZSTD to be defined!");
+				#endif
+				}
+				else {
+					throw std::runtime_error("File is not compressed!");
+				}
+			}
+			
+			Decompressor(const Decompressor& _other) = delete;
+			Decompressor& operator=(const Decompressor& _other) = delete;
+			
+			~Decompressor() {
+				
+			#if defined(ATHYG_ENABLE_ZLIB)
+				if (m_Compression == Compression::Gzip) {
+					inflateEnd(&m_Zlib);
+				}
+			#endif
+				
+			#if defined(ATHYG_ENABLE_ZSTD)
+				if (m_Compression == Compression::Zstd) {
+					ZSTD_freeDStream(m_Zstd);
+				}
+			#endif
+			}
+			
+			/**
+			 * @brief Decompresses the next bytes of the file.
+			 * @param[out] _data The buffer to write the decompressed bytes into.
+			 * @param[in] _size The size of the buffer.
+			 * @return The number of bytes written, which is less than _size only at the end of the file.
+			 * @throws std::runtime_error If the file is corrupt or truncated.
+			 */
+			size_t Read([[maybe_unused]] char* _data, const size_t& _size) {
+				
+				size_t result = 0U;
+				
+				// Whether the compressed file has been read in full. The decoder may still hold output that did not fit in the previous buffer.
+				[[maybe_unused]] bool exhausted = false;
+				
+			#if defined(ATHYG_ENABLE_ZLIB)
+				if (m_Compression == Compression::Gzip) {
+					
+					while (result < _size) {
+						
+						if (m_Zlib.avail_in == 0U) {
+							
+							const auto count = Fill();
+							
+							m_Zlib.next_in  = reinterpret_cast<Bytef*>(m_Input.data());
+							m_Zlib.avail_in = static_cast<uInt>(count);
+							
+							exhausted = count == 0U;
+							
+							if (exhausted && m_Complete) {
+								break;
+							}
+						}
+						
+						// Begin the next member of a multi-member file.
+						if (m_Complete) {
+							inflateReset(&m_Zlib);
+							m_Complete = false;
+						}
+						
+						const auto capacity = static_cast<uInt>(std::min(_size - result, static_cast<size_t>(std::numeric_limits<uInt>::max())));
+						
+						m_Zlib.next_out  = reinterpret_cast<Bytef*>(_data + result);
+						m_Zlib.avail_out = capacity;
+						
+						const auto status = inflate(&m_Zlib, Z_NO_FLUSH);
+						
+						// No progress is possible once the input is exhausted.
+						if (status == Z_BUF_ERROR && exhausted) {
+							break;
+						}
+						
+						if (status != Z_OK && status != Z_STREAM_END) {
+							throw std::runtime_error("Failed to decompress gzip file!");
+						}
+						
+						result += capacity - m_Zlib.avail_out;
+						
+						m_Complete = status == Z_STREAM_END;
+					}
+				}
+			#endif
+				
+			#if defined(ATHYG_ENABLE_ZSTD)
+				if (m_Compression == Compression::Zstd) {
+					
+					ZSTD_outBuffer output { _data, _size, 0U };
+					
+					while (output.pos < output.size) {
+						
+						if (m_ZstdInput.pos == m_ZstdInput.size) {
+							
+							const auto count = Fill();
+							
+							m_ZstdInput = { m_Input.data(), count, 0U };
+							
+							exhausted = count == 0U;
+							
+							if (exhausted && m_Complete) {
+								break;
+							}
+						}
+						
+						const auto before = output.pos;
+						const auto status = ZSTD_decompressStream(m_Zstd, &output, &m_ZstdInput);
+						
+						if (ZSTD_isError(status) != 0U) {
+							throw std::runtime_error("Failed to decompress Zstandard file: " + std::string(ZSTD_getErrorName(status)));
+						}
+						
+						m_Complete = status == 0U;
+						
+						// No progress is possible once the input is exhausted.
+						if (exhausted && output.pos == before) {
+							break;
+						}
+					}
+					
+					result = output.pos;
+				}
+			#endif
+				
+				if (result < _size && !m_Complete) {
+					throw std::runtime_error("Compressed file is truncated!");
+				}
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @class ReadAhead
+		 * @brief Produces blocks of a file on a background thread, ahead of their consumption.
+		 *
+		 * The producer runs on its own thread and hands blocks to the consumer through a bounded queue,
+		 * so producing (e.g. reading or decompressing) the next blocks overlaps with consuming the current one,
+		 * while at most a fixed number of blocks are held in memory.
+		 *
+		 * If the producer throws, the exception is rethrown to the consumer once every block produced before it has been consumed.
+		 * Destroying the object stops the producer and waits for its thread to finish.
+		 */
+		class ReadAhead final {
+			
+			std::mutex              m_Mutex;
+			std::condition_variable m_Condition;
+			std::deque<std::string> m_Blocks;
+			
+			size_t m_Depth;
+			
+			bool m_Closed;
+			bool m_Cancelled;
+			
+			std::exception_ptr m_Error;
+			
+			std::thread m_Thread;
+			
+			bool Push(std::string&& _block) {
+				
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				
+				m_Condition.wait(lock, [this]() { return m_Cancelled || m_Blocks.size() < m_Depth; });
+				
+				if (m_Cancelled) {
+					return false;
+				}
+				
+				m_Blocks.emplace_back(std::move(_block));
+				m_Condition.notify_all();
+				
+				return true;
+			}
+			
+			void Close(const std::exception_ptr& _error) {
+				
+				const std::lock_guard<std::mutex> lock(m_Mutex);
+				
+				m_Closed = true;
+				m_Error  = _error;
+				
+				m_Condition.notify_all();
+			}
+			
+		public:
+			
+			/**
+			 * @brief Starts producing blocks.
+			 *
+			 * @tparam F The type of the producer. Must be invocable with a function which accepts a std::string&&,
+			 * and returns false if the consumer has stopped, in which case the producer should return.
+			 * @param[in] _depth The maximum number of blocks waiting to be consumed.
+			 * @param[in] _producer The producer, which is invoked once on the background thread.
+			 */
+			template <typename F>
+			ReadAhead(const size_t& _depth, F&& _producer) :
+				m_Mutex(),
+				m_Condition(),
+				m_Blocks(),
+				m_Depth(std::max(_depth, static_cast<size_t>(1U))),
+				m_Closed(false),
+				m_Cancelled(false),
+				m_Error(),
+				m_Thread([this, producer = std::forward<F>(_producer)]() mutable {
+					
+					try {
+						producer([this](std::string&& _block) { return Push(std::move(_block)); });
+						Close(nullptr);
+					}
+					catch (...) {
+						Close(std::current_exception());
+					}
+				}) {}
+			
+			ReadAhead(const ReadAhead& _other) = delete;
+			ReadAhead& operator=(const ReadAhead& _other) = delete;
+			
+			~ReadAhead() {
+				
+				{
+					const std::lock_guard<std::mutex> lock(m_Mutex);
+					
+					m_Cancelled = true;
+					m_Condition.notify_all();
+				}
+				
+				m_Thread.join();
+			}
+			
+			/**
+			 * @brief Waits for the next block.
+			 * @param[out] _block The string to move the next block into.
+			 * @return True if a block was received, false if every block has been consumed.
+			 * @throws Rethrows any exception thrown by the producer.
+			 */
+			bool Next(std::string& _block) {
+				
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				
+				m_Condition.wait(lock, [this]() { return m_Closed || !m_Blocks.empty(); });
+				
+				if (m_Blocks.empty()) {
+					
+					if (m_Error) {
+						std::rethrow_exception(m_Error);
+					}
+					
+					return false;
+				}
+				
+				_block = std::move(m_Blocks.front());
+				m_Blocks.pop_front();
+				
+				m_Condition.notify_all();
+				
+				return true;
+			}
+		};
+		
+		/** @brief The number of blocks read ahead of the parser. */
+		static constexpr size_t s_ReadAheadDepth { 4U };
+		
+		/** @brief The size of each block read from a file, in bytes. */
+		static constexpr size_t s_ReadSize { 1U << 20U };
+		
+		/**
+		 * @class AsyncFile
+		 * @brief Reads a file sequentially in large blocks, issuing reads several blocks ahead of the consumer.
+		 *
+		 * Up to s_ReadAheadDepth reads are in flight at once, issued asynchronously using io_uring on Linux and overlapped I/O on Windows,
+		 * so reading the next blocks overlaps with consuming the current one. Elsewhere, or if io_uring is unavailable at runtime
+		 * (e.g. disabled by a seccomp policy), blocks are read by a background thread instead.
+		 *
+		 * Blocks are aligned to the page size in both length and offset, and buffers are recycled between reads,
+		 * so the working set is bounded by (s_ReadAheadDepth + 1) blocks.
+		 */
+		class AsyncFile final {
+			
+			struct Slot final {
+				
+				std::string buffer;
+				uint64_t    offset;
+				size_t      size;
+				size_t      done;
+				bool        pending;
+				
+			#if defined(_WIN32)
+				OVERLAPPED overlapped;
+			#elif defined(ATHYG_IO_URING)
+				iovec vector;
+			#endif
+			};
+			
+			std::vector<Slot> m_Slots;
+			
+			size_t   m_Block;
+			uint64_t m_Size;
+			uint64_t m_Next;
+			uint64_t m_Issued;
+			
+		#if defined(_WIN32)
+			HANDLE m_File;
+		#else
+			int m_File;
+			
+			std::optional<ReadAhead> m_Fallback;
+		#endif
+			
+		#if defined(ATHYG_IO_URING)
+			int m_Ring;
+			
+			void*         m_SqRing;
+			size_t        m_SqRingSize;
+			void*         m_CqRing;
+			size_t        m_CqRingSize;
+			io_uring_sqe* m_Sqes;
+			size_t        m_SqesSize;
+			
+			unsigned*      m_SqTail;
+			unsigned*      m_SqMask;
+			unsigned*      m_SqArray;
+			unsigned*      m_CqHead;
+			unsigned*      m_CqTail;
+			unsigned*      m_CqMask;
+			io_uring_cqe*  m_Cqes;
+			
+			/**
+			 * @brief Creates the submission and completion rings.
+			 * @return True if io_uring is available, false otherwise.
+			 */
+			bool Setup() noexcept {
+				
+				io_uring_params params {};
+				
+				m_Ring = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned>(m_Slots.size()), &params));
+				
+				if (m_Ring < 0) {
+					return false;
+				}
+				
+				m_SqRingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+				m_CqRingSize = params.cq_off.cqes  + (params.cq_entries * sizeof(io_uring_cqe));
+				m_SqesSize   = params.sq_entries * sizeof(io_uring_sqe);
+				
+				m_SqRing = mmap(nullptr, m_SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQ_RING);
+				m_CqRing = mmap(nullptr, m_CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_CQ_RING);
+				
+				void* sqes = mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQES);
+				
+				if (m_SqRing == MAP_FAILED || m_CqRing == MAP_FAILED || sqes == MAP_FAILED) {
+					
+					if (m_SqRing != MAP_FAILED) { munmap(m_SqRing, m_SqRingSize); }
+					if (m_CqRing != MAP_FAILED) { munmap(m_CqRing, m_CqRingSize); }
+					if (sqes     != MAP_FAILED) { munmap(sqes,     m_SqesSize);   }
+					
+					close(m_Ring);
+					m_Ring = -1;
+					
+					return false;
+				}
+				
+				auto* sq = static_cast<char*>(m_SqRing);
+				auto* cq = static_cast<char*>(m_CqRing);
+				
+				m_Sqes    = static_cast<io_uring_sqe*>(sqes);
+				m_SqTail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+				m_SqMask  = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+				m_SqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+				m_CqHead  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+				m_CqTail  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+				m_CqMask  = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+				m_Cqes    = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+				
+				return true;
+			}
+			
+			/**
+			 * @brief Waits for at least one read to complete, and processes every completed read.
+			 * @throws std::runtime_error If a read fails.
+			 */
+			void Reap() {
+				
+				auto head = *m_CqHead;
+				
+				while (head == __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE)) {
+					
+					if (syscall(__NR_io_uring_enter, m_Ring, 0U, 1U, IORING_ENTER_GETEVENTS, nullptr, 0U) < 0 && errno != EINTR) {
+						throw std::runtime_error("Failed to wait for a read!");
+					}
+				}
+				
+				for (; head != __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE); ++head) {
+					
+					const auto cqe = m_Cqes[head & *m_CqMask];
+					
+					__atomic_store_n(m_CqHead, head + 1U, __ATOMIC_RELEASE);
+					
+					Complete(m_Slots[static_cast<size_t>(cqe.user_data)], cqe.res);
+				}
+			}
+		#endif
+			
+			/**
+			 * @brief Issues the read of the remainder of a slot.
+			 * @param[in,out] _slot The slot.
+			 * @throws std::runtime_error If the read cannot be issued.
+			 */
+			void Submit(Slot& _slot) {
+				
+				_slot.pending = true;
+				
+			#if defined(_WIN32)
+				_slot.overlapped.Internal     = 0U;
+				_slot.overlapped.InternalHigh = 0U;
+				_slot.overlapped.Offset       = static_cast<DWORD>((_slot.offset + _slot.done) & 0xFFFFFFFFU);
+				_slot.overlapped.OffsetHigh   = static_cast<DWORD>((_slot.offset + _slot.done) >> 32U);
+				
+				ResetEvent(_slot.overlapped.hEvent);
+				
+				const auto size = static_cast<DWORD>(_slot.size - _slot.done);
+				
+				if (ReadFile(m_File, _slot.buffer.data() + _slot.done, size, nullptr, &_slot.overlapped) == FALSE && GetLastError() != ERROR_IO_PENDING) {
+					_slot.pending = false;
+					throw std::runtime_error("Failed to read file!");
+				}
+			#elif defined(ATHYG_IO_URING)
+				const auto tail  = *m_SqTail;
+				const auto index = tail & *m_SqMask;
+				
+				_slot.vector.iov_base = _slot.buffer.data() + _slot.done;
+				_slot.vector.iov_len  = _slot.size - _slot.done;
+				
+				auto& sqe = m_Sqes[index];
+				std::memset(&sqe, 0, sizeof(sqe));
+				
+				sqe.opcode    = IORING_OP_READV;
+				sqe.fd        = m_File;
+				sqe.addr      = reinterpret_cast<uint64_t>(&_slot.vector);
+				sqe.len       = 1U;
+				sqe.off       = _slot.offset + _slot.done;
+				sqe.user_data = static_cast<uint64_t>(&_slot - m_Slots.data());
+				
+				m_SqArray[index] = index;
+				
+				__atomic_store_n(m_SqTail, tail + 1U, __ATOMIC_RELEASE);
+				
+				while (syscall(__NR_io_uring_enter, m_Ring, 1U, 0U, 0U, nullptr, 0U) < 0) {
+					
+					if (errno != EINTR && errno != EAGAIN) {
+						_slot.pending = false;
+						throw std::runtime_error("Failed to read file!");
+					}
+				}
+			#endif
+			}
+			
+			/**
+			 * @brief Records the result of a read, issuing another read if it was short.
+			 * @param[in,out] _slot The slot.
+			 * @param[in] _result The number of bytes read, or a negative error code.
+			 * @throws std::runtime_error If the read failed, or reached the end of the file before the size it had when opened.
+			 */
+			void Complete(Slot& _slot, const int64_t& _result) {
+				
+				_slot.pending = false;
+				
+				if (_result < 0) {
+					
+				#if !defined(_WIN32)
+					if (_result == -EINTR || _result == -EAGAIN) {
+						Submit(_slot);
+						return;
+					}
+				#endif
+					
+					throw std::runtime_error("Failed to read file!");
+				}
+				
+				// The file was truncated while it was being read.
+				if (_result == 0) {
+					throw std::runtime_error("Failed to read file!");
+				}
+				
+				_slot.done += static_cast<size_t>(_result);
+				
+				if (_slot.done < _slot.size) {
+					Submit(_slot);
+				}
+			}
+			
+			/**
+			 * @brief Waits for a slot to be read in full.
+			 * @param[in,out] _slot The slot.
+			 * @throws std::runtime_error If a read fails.
+			 */
+			void Wait(Slot& _slot) {
+				
+				while (_slot.pending) {
+					
+				#if defined(_WIN32)
+					DWORD count = 0U;
+					
+					Complete(_slot, GetOverlappedResult(m_File, &_slot.overlapped, &count, TRUE) != FALSE ?
+						static_cast<int64_t>(count) :
+						(GetLastError() == ERROR_HANDLE_EOF ? 0 : -1));
+				#elif defined(ATHYG_IO_URING)
+					Reap();
+				#endif
+				}
+			}
+			
+			/**
+			 * @brief Issues the read of the next block of the file into a slot, if any remain.
+			 * @param[in,out] _slot The slot.
+			 */
+			void Issue(Slot& _slot) {
+				
+				if (m_Issued < m_Size) {
+					
+					_slot.offset = m_Issued;
+					_slot.size   = static_cast<size_t>(std::min(static_cast<uint64_t>(m_Block), m_Size - m_Issued));
+					_slot.done   = 0U;
+					
+					_slot.buffer.resize(m_Block);
+					
+					m_Issued += m_Block;
+					
+					Submit(_slot);
+				}
+			}
+			
+			void Release() noexcept {
+				
+				try {
+					
+					// Buffers must outlive the reads into them, so finish every outstanding read first.
+					for (auto& slot : m_Slots) {
+						
+						while (slot.pending) {
+							
+						#if defined(_WIN32)
+							CancelIoEx(m_File, &slot.overlapped);
+							
+							DWORD count = 0U;
+							GetOverlappedResult(m_File, &slot.overlapped, &count, TRUE);
+							
+							slot.pending = false;
+						#elif defined(ATHYG_IO_URING)
+							Reap();
+						#endif
+						}
+					}
+				}
+				catch (...) {
+					// Reads which fail while cancelling are ignored.
+				}
+				
+			#if defined(_WIN32)
+				for (auto& slot : m_Slots) {
+					
+					if (slot.overlapped.hEvent != nullptr) {
+						CloseHandle(slot.overlapped.hEvent);
+						slot.overlapped.hEvent = nullptr;
+					}
+				}
+				
+				if (m_File != INVALID_HANDLE_VALUE) {
+					CloseHandle(m_File);
+					m_File = INVALID_HANDLE_VALUE;
+				}
+			#else
+				
+				// The background thread reads from the file descriptor, so must be stopped before it is closed.
+				m_Fallback.reset();
+				
+			#if defined(ATHYG_IO_URING)
+				if (m_Ring != -1) {
+					
+					munmap(m_Sqes, m_SqesSize);
+					munmap(m_CqRing, m_CqRingSize);
+					munmap(m_SqRing, m_SqRingSize);
+					
+					close(m_Ring);
+					m_Ring = -1;
+				}
+			#endif
+				
+				if (m_File != -1) {
+					close(m_File);
+					m_File = -1;
+				}
+			#endif
+			}
+		public:
+			
+			/**
+			 * @brief Opens a file, and issues the reads of its first blocks.
+			 * @param[in] _path The path to the file.
+			 * @param[in] _block The size of each block in bytes, which is rounded up to a multiple of the page size.
+			 * @throws std::runtime_error If the file cannot be opened or read.
+			 */
+			AsyncFile(const std::filesystem::path& _path, const size_t& _block) :
+				m_Slots(s_ReadAheadDepth),
+				m_Block(((std::max(_block, static_cast<size_t>(1U)) + 4095U) / 4096U) * 4096U),
+				m_Size(0U),
+				m_Next(0U),
+				m_Issued(0U)
+			#if defined(_WIN32)
+				, m_File(INVALID_HANDLE_VALUE)
+			#else
+				, m_File(-1)
+				, m_Fallback()
+			#endif
+			#if defined(ATHYG_IO_URING)
+				, m_Ring(-1)
+				, m_SqRing(MAP_FAILED)
+				, m_SqRingSize(0U)
+				, m_CqRing(MAP_FAILED)
+				, m_CqRingSize(0U)
+				, m_Sqes(nullptr)
+				, m_SqesSize(0U)
+				, m_SqTail(nullptr)
+				, m_SqMask(nullptr)
+				, m_SqArray(nullptr)
+				, m_CqHead(nullptr)
+				, m_CqTail(nullptr)
+				, m_CqMask(nullptr)
+				, m_Cqes(nullptr)
+			#endif
+			{
+				for (auto& slot : m_Slots) {
+					
+					slot.offset  = 0U;
+					slot.size    = 0U;
+					slot.done    = 0U;
+					slot.pending = false;
+				}
+				
+			#if defined(_WIN32)
+				m_File = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				
+				if (m_File == INVALID_HANDLE_VALUE) {
+					throw std::runtime_error("Failed to open \"" + _path.string() + "\" for reading.");
+				}
+				
+				LARGE_INTEGER size;
+				
+				if (GetFileSizeEx(m_File, &size) == FALSE) {
+					CloseHandle(m_File);
+					throw std::runtime_error("Failed to query size of \"" + _path.string() + "\".");
+				}
+				
+				m_Size = static_cast<uint64_t>(size.QuadPart);
+				
+				for (auto& slot : m_Slots) {
+					slot.overlapped = OVERLAPPED();
+					slot.overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+				}
+			#else
+				m_File = open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+				
+				if (m_File == -1) {
+					throw std::runtime_error("Failed to open \"" + _path.string() + "\" for reading.");
+				}
+				
+				struct stat info {};
+				
+				if (fstat(m_File, &info) == -1) {
+					close(m_File);
+					throw std::runtime_error("Failed to query size of \"" + _path.string() + "\".");
+				}
+				
+				m_Size = static_cast<uint64_t>(info.st_size);
+				
+			#if defined(POSIX_FADV_SEQUENTIAL)
+				posix_fadvise(m_File, 0, 0, POSIX_FADV_SEQUENTIAL);
+			#endif
+				
+			#if defined(ATHYG_IO_URING)
+				const bool asynchronous = Setup();
+			#else
+				const bool asynchronous = false;
+			#endif
+				
+				if (!asynchronous) {
+					
+					m_Fallback.emplace(s_ReadAheadDepth, [file = m_File, block = m_Block, length = m_Size](const auto& _push) {
+						
+						// Read the size the file had when opened, as the asynchronous reads do.
+						for (uint64_t offset = 0U; offset < length;) {
+							
+							const auto size = static_cast<size_t>(std::min(static_cast<uint64_t>(block), length - offset));
+							
+							std::string buffer(size, '\0');
+							
+							for (size_t done = 0U; done < size;) {
+								
+								const auto count = pread(file, buffer.data() + done, size - done, static_cast<off_t>(offset + done));
+								
+								if (count < 0 && errno == EINTR) {
+									continue;
+								}
+								
+								// A read of zero bytes means the file was truncated while it was being read.
+								if (count <= 0) {
+									throw std::runtime_error("Failed to read file!");
+								}
+								
+								done += static_cast<size_t>(count);
+							}
+							
+							offset += size;
+							
+							if (!_push(std::move(buffer))) {
+								return;
+							}
+						}
+					});
+					
+					return;
+				}
+			#endif
+				
+				try {
+					
+					for (auto& slot : m_Slots) {
+						Issue(slot);
+					}
+				}
+				catch (...) {
+					Release();
+					throw;
+				}
+			}
+			
+			AsyncFile(const AsyncFile& _other) = delete;
+			AsyncFile& operator=(const AsyncFile& _other) = delete;
+			
+			~AsyncFile() {
+				Release();
+			}
+			
+			/**
+			 * @brief Waits for the next block of the file.
+			 * @param[in,out] _block The string to move the next block into. Its previous buffer is reused for a later read.
+			 * @return True if a block was received, false if the end of the file has been reached.
+			 * @throws std::runtime_error If a read fails, or the file was truncated while it was being read.
+			 */
+			bool Next(std::string& _block) {
+				
+			#if !defined(_WIN32)
+				if (m_Fallback.has_value()) {
+					return m_Fallback->Next(_block);
+				}
+			#endif
+				
+				if (m_Next >= m_Size) {
+					return false;
+				}
+				
+				auto& slot = m_Slots[static_cast<size_t>((m_Next / m_Block) % m_Slots.size())];
+				
+				Wait(slot);
+				
+				std::swap(_block, slot.buffer);
+				_block.resize(slot.size);
+				
+				m_Next += m_Block;
+				
+				Issue(slot);
+				
+				return true;
+			}
+		};
+		
+		/** @brief Whether the target stores multi-byte values with the most significant byte first. */
+	#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		static constexpr bool s_BigEndian { true };
+	#else
+		static constexpr bool s_BigEndian { false };
+	#endif
+		
+		/**
+		 * @brief Reverses the order of the bytes of an arithmetic value.
+		 * @tparam U The type of the value.
+		 * @param[in] _value The value.
+		 * @return The value with its bytes reversed.
+		 */
+		template <typename U>
+		static U ByteSwap(const U& _value) noexcept {
+			
+			static_assert(std::is_arithmetic_v<U>, "Template argument must be an arithmetic type!");
+			
+			std::array<unsigned char, sizeof(U)> bytes {};
+			std::memcpy(bytes.data(), &_value, sizeof(U));
+			std::reverse(bytes.begin(), bytes.end());
+			
+			U result;
+			std::memcpy(&result, bytes.data(), sizeof(U));
+			
+			return result;
+		}
+		
+		/**
+		 * @class Hasher
+		 * @brief Incrementally computes the 64-bit hash of a sequence of buffers using the XXH64 algorithm.
+		 *
+		 * Used to detect whether the source files of a binary cache have changed since it was written.
+		 * Input is consumed 32 bytes at a time in four independent lanes, so hashing runs at close to memory bandwidth.
+		 * The hash depends only on the concatenation of the buffers, not on how it is split between calls to Update.
+		 */
+		class Hasher final {
+			
+			static constexpr uint64_t s_P1 { 11400714785074694791ULL };
+			static constexpr uint64_t s_P2 { 14029467366897019727ULL };
+			static constexpr uint64_t s_P3 {  1609587929392839161ULL };
+			static constexpr uint64_t s_P4 {  9650029242287828579ULL };
+			static constexpr uint64_t s_P5 {  2870177450012600261ULL };
+			
+			uint64_t m_Seed;
+			uint64_t m_Length;
+			
+			std::array<uint64_t, 4U> m_Lanes;
+			std::array<char,    32U> m_Buffer;
+			
+			size_t m_Buffered;
+			
+			static constexpr uint64_t Rotl(const uint64_t& _x, const int& _r) noexcept {
+				return (_x << _r) | (_x >> (64 - _r));
+			}
+			
+			static constexpr uint64_t Round(uint64_t _acc, const uint64_t& _input) noexcept {
+				_acc += _input * s_P2;
+				_acc  = Rotl(_acc, 31);
+				return _acc * s_P1;
+			}
+			
+			static constexpr uint64_t Merge(uint64_t _acc, const uint64_t& _value) noexcept {
+				_acc ^= Round(0U, _value);
+				return _acc * s_P1 + s_P4;
+			}
+			
+			template <typename U>
+			static U Load(const char* _ptr) noexcept {
+				
+				U result;
+				std::memcpy(&result, _ptr, sizeof(U));
+				
+				return s_BigEndian ? ByteSwap(result) : result;
+			}
+			
+			void Stripe(const char* _ptr) noexcept {
+				m_Lanes[0] = Round(m_Lanes[0], Load<uint64_t>(_ptr));
+				m_Lanes[1] = Round(m_Lanes[1], Load<uint64_t>(_ptr +  8U));
+				m_Lanes[2] = Round(m_Lanes[2], Load<uint64_t>(_ptr + 16U));
+				m_Lanes[3] = Round(m_Lanes[3], Load<uint64_t>(_ptr + 24U));
+			}
+			
+		public:
+			
+			/**
+			 * @brief Begins a hash.
+			 * @param[in] _seed (optional) The seed of the hash.
+			 */
+			explicit Hasher(const uint64_t& _seed = 0U) noexcept :
+				m_Seed(_seed),
+				m_Length(0U),
+				m_Lanes { _seed + s_P1 + s_P2, _seed + s_P2, _seed, _seed - s_P1 },
+				m_Buffer(),
+				m_Buffered(0U) {}
+			
+			/**
+			 * @brief Appends a buffer to the hashed data.
+			 * @param[in] _data The buffer.
+			 */
+			void Update(std::string_view _data) noexcept {
+				
+				m_Length += static_cast<uint64_t>(_data.size());
+				
+				// Complete the stripe left over from the previous buffer.
+				if (m_Buffered != 0U) {
+					
+					const auto count = std::min(_data.size(), m_Buffer.size() - m_Buffered);
+					
+					std::memcpy(m_Buffer.data() + m_Buffered, _data.data(), count);
+					
+					m_Buffered += count;
+					_data.remove_prefix(count);
+					
+					if (m_Buffered < m_Buffer.size()) {
+						return;
+					}
+					
+					Stripe(m_Buffer.data());
+					m_Buffered = 0U;
+				}
+				
+				for (; _data.size() >= 32U; _data.remove_prefix(32U)) {
+					Stripe(_data.data());
+				}
+				
+				if (!_data.empty()) {
+					std::memcpy(m_Buffer.data(), _data.data(), _data.size());
+					m_Buffered = _data.size();
+				}
+			}
+			
+			/**
+			 * @brief Returns the hash of the data appended so far.
+			 * @return The hash.
+			 */
+			[[nodiscard]] uint64_t Digest() const noexcept {
+				
+				uint64_t result;
+				
+				if (m_Length >= 32U) {
+					
+					result = Rotl(m_Lanes[0], 1) + Rotl(m_Lanes[1], 7) + Rotl(m_Lanes[2], 12) + Rotl(m_Lanes[3], 18);
+					result = Merge(result, m_Lanes[0]);
+					result = Merge(result, m_Lanes[1]);
+					result = Merge(result, m_Lanes[2]);
+					result = Merge(result, m_Lanes[3]);
+				}
+				else {
+					result = m_Seed + s_P5;
+				}
+				
+				result += m_Length;
+				
+				const auto* ptr = m_Buffer.data();
+				const auto* end = m_Buffer.data() + m_Buffered;
+				
+				for (; end - ptr >= 8; ptr += 8) {
+					result ^= Round(0U, Load<uint64_t>(ptr));
+					result  = Rotl(result, 27) * s_P1 + s_P4;
+				}
+				
+				if (end - ptr >= 4) {
+					result ^= static_cast<uint64_t>(Load<uint32_t>(ptr)) * s_P1;
+					result  = Rotl(result, 23) * s_P2 + s_P3;
+					ptr += 4;
+				}
+				
+				for (; ptr < end; ++ptr) {
+					result ^= static_cast<uint64_t>(static_cast<unsigned char>(*ptr)) * s_P5;
+					result  = Rotl(result, 11) * s_P1;
+				}
+				
+				result ^= result >> 33;
+				result *= s_P2;
+				result ^= result >> 29;
+				result *= s_P3;
+				result ^= result >> 32;
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @brief Computes the 64-bit hash of a buffer using the XXH64 algorithm.
+		 * @param[in] _data The buffer to hash.
+		 * @param[in] _seed (optional) The seed of the hash.
+		 * @return The hash of the buffer.
+		 *
+		 * @see Hasher
+		 */
+		static uint64_t Hash(const std::string_view& _data, const uint64_t& _seed = 0U) noexcept {
+			
+			Hasher hasher(_seed);
+			hasher.Update(_data);
+			
+			return hasher.Digest();
+		}
+		
+		/**
+		 * @brief Invokes a function for every index in the range [0, _count) using a number of threads.
+		 *
+		 * Indices are claimed dynamically, so uneven workloads are balanced between threads.
+		 * The calling thread participates in the work. If only one thread is requested, every index is processed inline.
+		 *
+		 * @tparam F The type of the function. Must be invocable with a size_t.
+		 * @param[in] _count The number of indices to process.
+		 * @param[in] _threads The maximum number of threads to use.
+		 * @param[in] _func The function to invoke for each index.
+		 *
+		 * @note If any invocation throws, the remaining indices are abandoned and the first exception is rethrown on the calling thread.
+		 */
+		template <typename F>
+		static void ParallelFor(const size_t& _count, const size_t& _threads, F&& _func) {
+			
+			const auto workers = std::min(_count, _threads);
+			
+			if (workers <= 1U) {
+				
+				for (size_t i = 0U; i < _count; ++i) {
+					_func(i);
+				}
+			}
+			else {
+				
+				std::atomic<size_t> next { 0U };
+				
+				std::mutex         mutex;
+				std::exception_ptr error;
+				
+				const auto work = [&]() {
+					
+					for (size_t i; (i = next.fetch_add(1U)) < _count;) {
+						
+						try {
+							_func(i);
+						}
+						catch (...) {
+							
+							const std::lock_guard<std::mutex> lock(mutex);
+							
+							if (!error) {
+								error = std::current_exception();
+							}
+							
+							next = _count;
+						}
+					}
+				};
+				
+				std::vector<std::thread> pool;
+				pool.reserve(workers - 1U);
+				
+				try {
+					
+					for (size_t i = 1U; i < workers; ++i) {
+						pool.emplace_back(work);
+					}
+				}
+				catch (const std::system_error&) {
+					/* Continue with however many threads could be started. */
+				}
+				
+				work();
+				
+				for (auto& thread : pool) {
+					thread.join();
+				}
+				
+				if (error) {
+					std::rethrow_exception(error);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Returns the number of NUMA nodes of the machine.
+		 * @return One more than the highest node, or 1 unless ATHYG_ENABLE_NUMA is defined and libnuma is available.
+		 */
+		[[nodiscard]] static size_t Nodes() noexcept {
+			
+		#if defined(ATHYG_ENABLE_NUMA)
+			static const size_t s_Nodes = numa_available() < 0 ? 1U : static_cast<size_t>(std::max(numa_max_node() + 1, 1));
+			
+			return s_Nodes;
+		#else
+			return 1U;
+		#endif
+		}
+		
+		/**
+		 * @brief Returns the NUMA node of the processor the calling thread is running on.
+		 * @return The node, or 0 if it cannot be determined.
+		 */
+		[[nodiscard]] static size_t Node() noexcept {
+			
+		#if defined(ATHYG_ENABLE_NUMA)
+			if (Nodes() > 1U) {
+				
+				const auto cpu  = sched_getcpu();
+				const auto node = cpu < 0 ? -1 : numa_node_of_cpu(cpu);
+				
+				return node < 0 ? 0U : std::min(static_cast<size_t>(node), Nodes() - 1U);
+			}
+		#endif
+			
+			return 0U;
+		}
+		
+		/**
+		 * @class Pin
+		 * @brief Restricts the calling thread to the processors of a NUMA node, for as long as the pin exists.
+		 *
+		 * The affinity of the thread is restored when the pin is destroyed, so a pin may be taken by a thread which is not owned by the library.
+		 */
+		class Pin final {
+			
+		#if defined(ATHYG_ENABLE_NUMA)
+			bitmask* m_Affinity;
+		#endif
+			
+		public:
+			
+			/**
+			 * @brief Restricts the calling thread to a node. Does nothing if the machine has a single node.
+			 * @param[in] _node The node.
+			 */
+			explicit Pin([[maybe_unused]] const size_t& _node) noexcept {
+				
+			#if defined(ATHYG_ENABLE_NUMA)
+				m_Affinity = nullptr;
+				
+				if (Nodes() > 1U) {
+					
+					m_Affinity = numa_allocate_cpumask();
+					
+					if (m_Affinity != nullptr && numa_sched_getaffinity(0, m_Affinity) < 0) {
+						numa_free_cpumask(m_Affinity);
+						m_Affinity = nullptr;
+					}
+					
+					if (m_Affinity != nullptr) {
+						static_cast<void>(numa_run_on_node(static_cast<int>(_node)));
+					}
+				}
+			#endif
+			}
+			
+			Pin(const Pin&) = delete;
+			Pin& operator = (const Pin&) = delete;
+			
+			~Pin() {
+				
+			#if defined(ATHYG_ENABLE_NUMA)
+				if (m_Affinity != nullptr) {
+					static_cast<void>(numa_sched_setaffinity(0, m_Affinity));
+					numa_free_cpumask(m_Affinity);
+				}
+			#endif
+			}
+		};
+		
+		/**
+		 * @brief Spreads the pages of a buffer evenly across the NUMA nodes, in order, so that its first 1/n is local to node 0, its next 1/n to node 1, and so on.
+		 *
+		 * Pages which have not been touched are allocated on their node when they are first touched, by whichever thread touches them.
+		 * Pages which have are migrated to their node. Only the pages lying entirely within the buffer are placed.
+		 *
+		 * @param[in] _data The buffer.
+		 * @param[in] _bytes The size of the buffer, in bytes.
+		 *
+		 * @note Placement is best-effort, and does nothing if the machine has a single node.
+		 */
+		static void Spread(const void* _data, const size_t& _bytes) noexcept {
+			
+			Spread(_data, _bytes, [&_bytes](const size_t& _node, const size_t& _nodes) {
+				return (_bytes * _node) / _nodes;
+			});
+		}
+		
+		/**
+		 * @brief Spreads the pages of a buffer across the NUMA nodes, in order, dividing it at the given offsets rather than evenly.
+		 *
+		 * @param[in] _data The buffer.
+		 * @param[in] _bytes The size of the buffer, in bytes.
+		 * @param[in] _boundary A function returning the offset in bytes at which the part of a node begins, given the node and the number of nodes.
+		 * Must not decrease with the node, and must return 0 for the first.
+		 *
+		 * @see Spread(const void*, const size_t&)
+		 */
+		template <typename F>
+		static void Spread([[maybe_unused]] const void* _data, [[maybe_unused]] const size_t& _bytes, [[maybe_unused]] F&& _boundary) noexcept {
+			
+		#if defined(ATHYG_ENABLE_NUMA)
+			const auto nodes = Nodes();
+			
+			if (nodes <= 1U || _data == nullptr) {
+				return;
+			}
+			
+			const auto page    = static_cast<uintptr_t>(numa_pagesize());
+			const auto address = reinterpret_cast<uintptr_t>(_data);
+			
+			const auto first = ((address + page - 1U) / page) * page;
+			const auto last  = ((address + _bytes)    / page) * page;
+			
+			auto* const mask = numa_allocate_nodemask();
+			
+			if (mask == nullptr) {
+				return;
+			}
+			
+			for (size_t node = 0U; node < nodes; ++node) {
+				
+				const auto begin = std::max(first, ((address + static_cast<uintptr_t>(_boundary(node, nodes))) / page) * page);
+				const auto end   = node + 1U == nodes ? last : std::min(last, ((address + static_cast<uintptr_t>(_boundary(node + 1U, nodes))) / page) * page);
+				
+				if (begin < end) {
+					
+					numa_bitmask_clearall(mask);
+					numa_bitmask_setbit(mask, static_cast<unsigned int>(node));
+					
+					// Prefer, rather than bind to, the node, so that an allocation falls back to another node if the node is full.
+					static_cast<void>(mbind(reinterpret_cast<void*>(begin), end - begin, MPOL_PREFERRED, mask->maskp, mask->size + 1U, MPOL_MF_MOVE));
+				}
+			}
+			
+			numa_bitmask_free(mask);
+		#endif
+		}
+		
+		/**
+		 * @brief Spreads the elements of a contiguous container evenly across the NUMA nodes.
+		 * @param[in] _container The container, such as a std::vector or std::string.
+		 * @param[in] _count The number of elements to spread, which may exceed the size of the container if its capacity does.
+		 * @see Spread(const void*, const size_t&)
+		 */
+		template <typename V>
+		static void Spread(const V& _container, const size_t& _count) noexcept {
+			Spread(static_cast<const void*>(_container.data()), std::min(_count, _container.capacity()) * sizeof(typename V::value_type));
+		}
+		
+		/**
+		 * @brief Invokes a function for every index in the range [0, _count) using a number of threads, divided between the NUMA nodes.
+		 *
+		 * The range is divided between the nodes in order, as by Spread. Threads are pinned to the nodes in turn, and claim the indices of their own node first,
+		 * then help the threads of the other nodes. On a machine with a single node, behaves identically to ParallelFor.
+		 *
+		 * @tparam F The type of the function. Must be invocable with a size_t.
+		 * @param[in] _count The number of indices to process.
+		 * @param[in] _threads The maximum number of threads to use.
+		 * @param[in] _func The function to invoke for each index.
+		 *
+		 * @note If any invocation throws, the remaining indices are abandoned and the first exception is rethrown on the calling thread.
+		 *
+		 * @see ParallelFor
+		 */
+		template <typename F>
+		static void NodeFor(const size_t& _count, const size_t& _threads, F&& _func) {
+			
+			const auto nodes   = std::min(Nodes(), _count);
+			const auto workers = std::min(_count, _threads);
+			
+			if (nodes <= 1U || workers <= 1U) {
+				ParallelFor(_count, _threads, std::forward<F>(_func));
+			}
+			else {
+				
+				const std::unique_ptr<std::atomic<size_t>[]> next(new std::atomic<size_t>[nodes]);
+				
+				for (size_t node = 0U; node < nodes; ++node) {
+					next[node] = (_count * node) / nodes;
+				}
+				
+				std::atomic<bool> stop { false };
+				
+				ParallelFor(workers, workers, [&](const size_t& _worker) {
+					
+					const auto home = _worker % nodes;
+					
+					const Pin pin(home);
+					
+					for (size_t n = 0U; n < nodes && !stop; ++n) {
+						
+						const auto node = (home + n) % nodes;
+						const auto end  = (_count * (node + 1U)) / nodes;
+						
+						for (size_t i; !stop && (i = next[node].fetch_add(1U)) < end;) {
+							
+							try {
+								_func(i);
+							}
+							catch (...) {
+								stop = true;
+								throw;
+							}
+						}
+					}
+				});
+			}
+		}
+		
+		/**
+		 * @brief Returns the rows of an ATHYG CSV file, excluding the header.
+		 * @param[in] _csv The contents of the CSV file.
+		 * @return A std::string_view beginning at the first character after the header.
+		 */
+		static constexpr std::string_view SkipHeader(const std::string_view& _csv) noexcept {
+			
+			const auto end = _csv.find('\n');
+			
+			return end == std::string_view::npos ?
+				std::string_view() :
+				_csv.substr(end + 1U);
+		}
+		
+		/**
+		 * @brief Splits the rows of an ATHYG CSV file into newline-aligned chunks.
+		 *
+		 * Each chunk is at least _target bytes long (except for the last), and ends immediately after a newline character.
+		 * Chunks can be parsed independently of one another, provided that no quoted field spans a chunk boundary (ATHYG fields never contain newlines).
+		 *
+		 * @param[in] _rows The rows to split.
+		 * @param[in] _target The approximate size of each chunk in bytes.
+		 * @return A vector containing the chunks, in order.
+		 */
+		static std::vector<std::string_view> Chunk(std::string_view _rows, const size_t& _target) {
+			
+			std::vector<std::string_view> result;
+			result.reserve((_rows.size() / std::max(_target, static_cast<size_t>(1U))) + 1U);
+			
+			while (!_rows.empty()) {
+				
+				auto end = _rows.size() > _target ?
+					_rows.find('\n', _target) :
+					std::string_view::npos;
+				
+				end = (end == std::string_view::npos) ? _rows.size() : end + 1U;
+				
+				result.emplace_back(_rows.substr(0U, end));
+				_rows.remove_prefix(end);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Reads the rows of an ATHYG CSV file in newline-aligned blocks, invoking a function with each block.
+		 *
+		 * When reading into a buffer, at most one block (plus one partial row) of the file is held in memory at a time in addition to the reads in flight,
+		 * which bounds the memory used to read arbitrarily large files. Mapped files are mapped in full, and each block is a view of the mapping.
+		 *
+		 * Uncompressed files are read by an AsyncFile, and compressed files are decompressed on a background thread,
+		 * in both cases up to s_ReadAheadDepth reads ahead of the function, so reading overlaps with parsing.
+		 * Only the compressed file is ever stored on disk.
+		 *
+		 * @tparam H The type of the header function. Must be invocable with a const std::string_view&.
+		 * @tparam F The type of the function. Must be invocable with a const std::string_view&, and return a bool.
+		 * @param[in] _path The path to the file.
+		 * @param[in] _source The strategy used to read the file.
+		 * @param[in] _target The approximate size of each block in bytes.
+		 * @param[in] _header The function to invoke with the header, excluding the newline, before the first block.
+		 * @param[in] _func The function to invoke with each block, which returns false to stop reading.
+		 * @return False if the function stopped reading, true otherwise.
+		 * @throws std::runtime_error If the file cannot be read or mapped.
+		 *
+		 * @note The header is not included in any block, and blocks never end partway through a row.
+		 */
+		template <typename H, typename F>
+		static bool ReadBlocks(const std::filesystem::path& _path, const Source& _source, const size_t& _target, H&& _header, F&& _func) {
+			
+			const auto target = std::max(_target, static_cast<size_t>(1U));
+			
+			const auto compression = Detect(_path);
+			
+			if (_source == Source::Mapped && compression == Compression::None) {
+				
+				const MappedFile file(_path);
+				
+				const auto view = file.View();
+				const auto end  = view.find('\n');
+				
+				if (end != std::string_view::npos) {
+					_header(view.substr(0U, end));
+				}
+				
+				for (const auto& block : Chunk(SkipHeader(view), target)) {
+					
+					if (!_func(block)) {
+						return false;
+					}
+				}
+			}
+			else {
+				
+				// Uncompressed files are read asynchronously, and compressed files are decompressed on a background thread, a few blocks ahead of the parser.
+				std::optional<AsyncFile> file;
+				std::optional<ReadAhead> decompressed;
+				
+				if (compression == Compression::None) {
+					file.emplace(_path, s_ReadSize);
+				}
+				else {
+					
+					decompressed.emplace(s_ReadAheadDepth, [_path, compression](const auto& _push) {
+						
+						Decompressor decompressor(_path, compression);
+						
+						for (bool more = true; more;) {
+							
+							std::string block(s_ReadSize, '\0');
+							block.resize(decompressor.Read(block.data(), block.size()));
+							
+							more = block.size() == s_ReadSize;
+							
+							if (!block.empty() && !_push(std::move(block))) {
+								return;
+							}
+						}
+					});
+				}
+				
+				std::string buffer;
+				std::string block;
+				
+				bool header = true;
+				bool eof    = false;
+				
+				while (!eof) {
+					
+					// Append blocks to the partial row carried over from the previous call, until there is enough to process.
+					do {
+						
+						const auto more = file.has_value() ?
+							file->Next(block) :
+							decompressed->Next(block);
+						
+						if (more) {
+							buffer.append(block);
+						}
+						
+						eof = !more;
+					}
+					while (!eof && buffer.size() < target);
+					
+					std::string_view rows(buffer);
+					
+					if (header) {
+						
+						const auto end = rows.find('\n');
+						
+						if (end == std::string_view::npos) {
+							continue;
+						}
+						
+						_header(rows.substr(0U, end));
+						
+						rows.remove_prefix(end + 1U);
+						header = false;
+					}
+					
+					// Hold back the trailing partial row until the rest of it is read, unless the file has ended.
+					const auto end = eof ? rows.size() : rows.rfind('\n') + 1U;
+					
+					if (end != 0U && !_func(rows.substr(0U, end))) {
+						return false;
+					}
+					
+					buffer.erase(0U, buffer.size() - (rows.size() - end));
+				}
+			}
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Reads the rows of an ATHYG CSV file in newline-aligned blocks, invoking a function with each block, and ignoring the header.
+		 * @see ReadBlocks(const std::filesystem::path&, const Source&, const size_t&, H&&, F&&)
+		 */
+		template <typename F>
+		static bool ReadBlocks(const std::filesystem::path& _path, const Source& _source, const size_t& _target, F&& _func) {
+			return ReadBlocks(_path, _source, _target, [](const std::string_view&) noexcept {}, std::forward<F>(_func));
+		}
+		
+		/**
+		 * @brief Splits a string into a vector of substrings based on a delimiter.
+		 *
+		 * The provided string is split into substrings using the specified delimiter.
+		 * The substrings are then stored in a vector and returned.
+		 * If the template argument is std::string, the substrings are stored as std::string objects.
+		 * If the template argument is std::string_view, the substrings are stored as std::string_view objects.
+		 *
+		 * @param[in] _string The string to split.
+		 * @param[in] _divider The delimiter character to split the string by.
+		 * @param[in] _capacity (optional) The initial capacity of the result vector. Defaults to 0.
+		 *
+		 * @tparam T The type of the resulting substrings. Must be either std::string or std::string_view.
+		 *
+		 * @return std::vector<T> A vector containing the substrings.
+		 *
+		 * @note The function assumes that the provided delimiter is a single character.
+		 * @note If _capacity is specified, the internal vector capacity is set to that value.
+		 * @note The last word of the string is always included in the result, even if it is not delimited.
+		 * @note The function assumes that the template argument is std::string or std::string_view.
+		 */
+		template<typename T = std::string_view>
+		static constexpr std::vector<T> Split(const std::string_view& _string, const char& _divider, const size_t& _capacity = 0U) {
+			
+			static_assert(std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>,
+                  "Template argument must be std::string or std::string_view");
+    
+			std::vector<T> result;
+			result.reserve(_capacity);
+			
+			// Boost library version of string splitting.
+			// (https://www.boost.org/doc/libs/1_54_0/doc/html/string_algo/usage.html#idp166856528)
+			std::string::size_type start = 0U;
+			std::string::size_type end = 0U;
+			
+			while((end = _string.find(_divider, start)) != std::string::npos) {
+			    result.emplace_back(_string.substr(start, end - start));
+			    start = end + 1U;
+			}
+			
+			// Last word is not delimited.
+			result.emplace_back(_string.substr(start));
+			
+			return result;
+		}
+		
+		/**
+		 * @struct Scanner
+		 * @brief Vectorised scanner for the structural characters of CSV data.
+		 *
+		 * Input is classified in blocks of 64 bytes, producing one bitmask per block for each of the comma, newline and quote characters,
+		 * where bit i of a mask corresponds to byte i of the block. Commas and newlines enclosed in double quotes are masked out,
+		 * after which the remaining structural characters are visited in order using a count of trailing zeros.
+		 *
+		 * The instruction set is selected at compile time: AVX2 or SSE2 on x86, NEON on AArch64, otherwise a portable scalar fallback.
+		 * Defining ATHYG_NO_SIMD forces the scalar fallback.
+		 */
+		struct Scanner final {
+			
+			/** @brief The number of bytes classified at a time. */
+			static constexpr size_t s_BlockSize { 64U };
+			
+			/**
+			 * @struct Masks
+			 * @brief Bitmasks of the structural characters within a block.
+			 */
+			struct Masks final {
+				
+				uint64_t comma;
+				uint64_t newline;
+				uint64_t quote;
+			};
+			
+			/**
+			 * @brief Classifies the structural characters of a block.
+			 * @param[in] _block Pointer to a block of exactly s_BlockSize readable bytes.
+			 * @return The bitmasks of the comma, newline and quote characters within the block.
+			 */
+			static Masks Classify(const char* _block) noexcept {
+				
+			#if defined(ATHYG_SIMD_AVX2)
+				
+				const auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_block      ));
+				const auto hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_block + 32U));
+				
+				const auto match = [&lo, &hi](const char& _c) noexcept {
+					
+					const auto c = _mm256_set1_epi8(_c);
+					
+					return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, c)))       ) |
+					       static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, c)))) << 32U;
+				};
+				
+			#elif defined(ATHYG_SIMD_SSE2)
+				
+				const __m128i lanes[4U] {
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(_block      )),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(_block + 16U)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(_block + 32U)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(_block + 48U))
+				};
+				
+				const auto match = [&lanes](const char& _c) noexcept {
+					
+					const auto c = _mm_set1_epi8(_c);
+					
+					uint64_t result = 0U;
+					
+					for (size_t i = 0U; i < 4U; ++i) {
+						result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lanes[i], c)))) << (i * 16U);
+					}
+					
+					return result;
+				};
+				
+			#elif defined(ATHYG_SIMD_NEON)
+				
+				const uint8x16_t lanes[4U] {
+					vld1q_u8(reinterpret_cast<const uint8_t*>(_block      )),
+					vld1q_u8(reinterpret_cast<const uint8_t*>(_block + 16U)),
+					vld1q_u8(reinterpret_cast<const uint8_t*>(_block + 32U)),
+					vld1q_u8(reinterpret_cast<const uint8_t*>(_block + 48U))
+				};
+				
+				const auto match = [&lanes](const char& _c) noexcept {
+					
+					static constexpr std::array<uint8_t, 16U> s_Bits { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+					
+					const auto bits = vld1q_u8(s_Bits.data());
+					const auto c    = vdupq_n_u8(static_cast<uint8_t>(_c));
+					
+					// Weight each matching byte by its position within its half-lane, then fold the four lanes into 64 bits using pairwise additions.
+					const auto a = vandq_u8(vceqq_u8(lanes[0U], c), bits);
+					const auto b = vandq_u8(vceqq_u8(lanes[1U], c), bits);
+					const auto d = vandq_u8(vceqq_u8(lanes[2U], c), bits);
+					const auto e = vandq_u8(vceqq_u8(lanes[3U], c), bits);
+					
+					auto sum = vpaddq_u8(vpaddq_u8(a, b), vpaddq_u8(d, e));
+					sum      = vpaddq_u8(sum, sum);
+					
+					return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+				};
+				
+			#else
+				
+				const auto match = [_block](const char& _c) noexcept {
+					
+					uint64_t result = 0U;
+					
+					for (size_t i = 0U; i < s_BlockSize; ++i) {
+						result |= static_cast<uint64_t>(_block[i] == _c) << i;
+					}
+					
+					return result;
+				};
+				
+			#endif
+				
+				return { match(','), match('\n'), match('"') };
+			}
+			
+			/**
+			 * @brief Computes the prefix XOR of a bitmask.
+			 *
+			 * Bit i of the result is the XOR of bits 0 through i of the input.
+			 * Applied to a mask of quote characters, this yields a mask of the bytes enclosed in quotes.
+			 *
+			 * @param[in] _mask The bitmask.
+			 * @return The prefix XOR of the bitmask.
+			 */
+			static constexpr uint64_t PrefixXor(uint64_t _mask) noexcept {
+				
+				_mask ^= _mask <<  1U;
+				_mask ^= _mask <<  2U;
+				_mask ^= _mask <<  4U;
+				_mask ^= _mask <<  8U;
+				_mask ^= _mask << 16U;
+				_mask ^= _mask << 32U;
+				
+				return _mask;
+			}
+			
+			/**
+			 * @brief Returns the index of the lowest set bit of a non-zero bitmask.
+			 * @param[in] _mask The bitmask. Must not be zero.
+			 * @return The number of trailing zero bits.
+			 */
+			static size_t CountTrailingZeros(const uint64_t& _mask) noexcept {
+				
+			#if defined(__GNUC__) || defined(__clang__)
+				return static_cast<size_t>(__builtin_ctzll(_mask));
+			#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+				unsigned long result;
+				_BitScanForward64(&result, _mask);
+				
+				return static_cast<size_t>(result);
+			#else
+				size_t result = 0U;
+				while (((_mask >> result) & 1U) == 0U) {
+					++result;
+				}
+				
+				return result;
+			#endif
+			}
+			
+			/**
+			 * @brief Returns the number of set bits in a bitmask.
+			 * @param[in] _mask The bitmask.
+			 * @return The population count of the bitmask.
+			 */
+			static size_t PopCount(const uint64_t& _mask) noexcept {
+				
+			#if defined(__GNUC__) || defined(__clang__)
+				return static_cast<size_t>(__builtin_popcountll(_mask));
+			#else
+				return std::bitset<64U>(_mask).count();
+			#endif
+			}
+			
+			/**
+			 * @brief Counts the rows of a CSV buffer without tokenising them.
+			 *
+			 * Newlines within double-quoted fields are not counted, consistent with Rows.
+			 *
+			 * @param[in] _rows The CSV buffer. Must not contain the header.
+			 * @return The number of rows that Rows would produce for the buffer.
+			 */
+			static size_t Count(const std::string_view& _rows) noexcept {
+				
+				size_t result = 0U;
+				
+				uint64_t quoted = 0U;
+				
+				for (size_t offset = 0U; offset < _rows.size(); offset += s_BlockSize) {
+					
+					const char* block = _rows.data() + offset;
+					
+					std::array<char, s_BlockSize> tail;
+					
+					if (_rows.size() - offset < s_BlockSize) {
+						
+						tail.fill('\0');
+						std::memcpy(tail.data(), block, _rows.size() - offset);
+						
+						block = tail.data();
+					}
+					
+					const auto masks = Classify(block);
+					
+					const auto inside = PrefixXor(masks.quote) ^ quoted;
+					quoted = static_cast<uint64_t>(0U) - (inside >> 63U);
+					
+					result += PopCount(masks.newline & ~inside);
+				}
+				
+				// Last row is not delimited.
+				if (!_rows.empty() && _rows.back() != '\n') {
+					++result;
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Tokenises every row of a CSV buffer, invoking a function with the fields of each row.
+			 *
+			 * The first _Limit fields of each row are written into a fixed-size array of std::string_view objects referencing the buffer.
+			 * Fields beyond the limit are counted but not stored, and a trailing carriage return is stripped from the last field of each row.
+			 * Commas and newlines within double-quoted fields are treated as part of the field.
+			 *
+			 * @tparam _Nm The size of the array of fields.
+			 * @tparam _Limit The maximum number of fields to store per row. Must not exceed _Nm.
+			 * @tparam F The type of the function. Must be invocable with a const std::array<std::string_view, _Nm>& and a const size_t&.
+			 * @param[in] _rows The CSV buffer to tokenise. Must not contain the header.
+			 * @param[in] _func The function to invoke with the fields of each row, and the total number of fields in the row.
+			 *
+			 * @note The last row of the buffer is always included, even if it is not terminated by a newline.
+			 * @note Elements of the array at or beyond the number of stored fields are left unspecified.
+			 */
+			template <size_t _Nm, size_t _Limit = _Nm, typename F>
+			static void Rows(const std::string_view& _rows, F&& _func) {
+				
+				static_assert(_Limit <= _Nm, "Cannot store more fields than the size of the array!");
+				
+				std::array<std::string_view, _Nm> fields;
+				
+				size_t count = 0U;
+				size_t start = 0U;
+				
+				// Whether the end of the previous block was enclosed in quotes, as a mask of all ones or all zeros.
+				uint64_t quoted = 0U;
+				
+				const auto emit = [&](const size_t& _end) {
+					
+					if (count < _Limit) {
+						
+						std::string_view field(_rows.data() + start, _end - start);
+						
+						if (!field.empty() && field.back() == '\r') {
+							field.remove_suffix(1U);
+						}
+						
+						fields[count] = field;
+					}
+					
+					++count;
+					
+					_func(std::as_const(fields), std::as_const(count));
+					
+					count = 0U;
+				};
+				
+				for (size_t offset = 0U; offset < _rows.size(); offset += s_BlockSize) {
+					
+					const char* block = _rows.data() + offset;
+					
+					// Pad the final partial block so that it can be classified safely.
+					std::array<char, s_BlockSize> tail;
+					
+					if (_rows.size() - offset < s_BlockSize) {
+						
+						tail.fill('\0');
+						std::memcpy(tail.data(), block, _rows.size() - offset);
+						
+						block = tail.data();
+					}
+					
+					const auto masks = Classify(block);
+					
+					const auto inside = PrefixXor(masks.quote) ^ quoted;
+					quoted = static_cast<uint64_t>(0U) - (inside >> 63U);
+					
+					auto structural = (masks.comma | masks.newline) & ~inside;
+					
+					while (structural != 0U) {
+						
+						if (count >= _Limit) {
+							
+							// Remaining fields of the row are not stored, so count their delimiters in bulk up to the end of the row.
+							const auto newlines = structural & masks.newline;
+							
+							if (newlines == 0U) {
+								count += PopCount(structural);
+								break;
+							}
+							
+							const auto before = (newlines & (static_cast<uint64_t>(0U) - newlines)) - 1U;
+							
+							count      += PopCount(structural & before);
+							structural &= ~before;
+						}
+						
+						const auto bit      = CountTrailingZeros(structural);
+						const auto position = offset + bit;
+						
+						if (((masks.newline >> bit) & 1U) != 0U) {
+							emit(position);
+						}
+						else {
+							
+							if (count < _Limit) {
+								fields[count] = std::string_view(_rows.data() + start, position - start);
+							}
+							
+							++count;
+						}
+						
+						start       = position + 1U;
+						structural &= structural - 1U;
+					}
+				}
+				
+				// Last row is not delimited.
+				if (start < _rows.size() || count != 0U) {
+					emit(_rows.size());
+				}
+			}
+		};
+		
+		/**
+		 * @brief Splits a CSV row into a fixed number of fields without allocating.
+		 *
+		 * The boundaries of each field are written directly into the provided array as std::string_view objects referencing the row.
+		 * Tokenising stops once the array is full, so any fields beyond its size are discarded.
+		 *
+		 * @tparam _Nm The maximum number of fields to tokenise.
+		 * @param[in] _line The CSV row to split.
+		 * @param[out] _fields The array to write the fields into.
+		 * @return The number of fields written, which is less than _Nm if the row contains fewer fields.
+		 *
+		 * @note The last field of the row is always included in the result, even if it is not delimited.
+		 * @note If _line contains more than one row, only the first is tokenised.
+		 *
+		 * @see Scanner::Rows
+		 */
+		template<size_t _Nm>
+		static size_t Tokenise(const std::string_view& _line, std::array<std::string_view, _Nm>& _fields) noexcept {
+			
+			size_t result = 0U;
+			
+			bool first = true;
+			
+			Scanner::Rows<_Nm>(_line, [&](const std::array<std::string_view, _Nm>& _row, const size_t& _count) noexcept {
+				
+				if (first) {
+					
+					first   = false;
+					_fields = _row;
+					result  = std::min(_count, _Nm);
+				}
+			});
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Parses a string into a number using the C library (strtol, strtod, etc.).
+		 *
+		 * The string is copied into a null-terminated buffer before it is parsed, so that parsing cannot continue beyond the end of the string.
+		 *
+		 * @tparam T The arithmetic type to parse the string into.
+		 * @param[in] _str The string to parse.
+		 * @return An optional value of type T, containing the parsed value if any characters were consumed, or an empty optional otherwise.
+		 *
+		 * @note The result depends on the current C locale.
+		 * @note Used by TryParse in place of std::from_chars if ATHYG_USE_STRTOD is defined, e.g. for bit-exact comparison with other C programs.
+		 */
+		template <typename T>
+		static std::optional<T> ParseCString(const std::string_view& _str) noexcept {
+			
+			T r;
+			
+			std::array<char, 64U> buffer;
+			
+			// Fields are short, so only fall back to the heap for unusually long strings.
+			std::string fallback;
+			
+			const char* s = buffer.data();
+			
+			if (_str.size() < buffer.size()) {
+				std::memcpy(buffer.data(), _str.data(), _str.size());
+				buffer[_str.size()] = '\0';
+			}
+			else {
+				
+				try {
+					fallback = _str;
+				}
+				catch (const std::exception&) {
+					return std::nullopt;
+				}
+				
+				s = fallback.c_str();
+			}
+			
+			char* e          = nullptr; // (end)
+			constexpr auto b = 10;      // (base)
+			
+			     if constexpr (std::is_same_v<T, int                >) { r = static_cast<T>(std::strtol  (s, &e, b)); }
+			else if constexpr (std::is_same_v<T, short              >) { r = static_cast<T>(std::strtol  (s, &e, b)); }
+			else if constexpr (std::is_same_v<T, long               >) { r =                std::strtol  (s, &e, b ); }
+			else if constexpr (std::is_same_v<T, long long          >) { r =                std::strtoll (s, &e, b ); }
+			else if constexpr (std::is_same_v<T, unsigned int       >) { r = static_cast<T>(std::strtoul (s, &e, b)); }
+			else if constexpr (std::is_same_v<T, unsigned short     >) { r = static_cast<T>(std::strtoul (s, &e, b)); }
+			else if constexpr (std::is_same_v<T, unsigned long      >) { r =                std::strtoul (s, &e, b ); }
+			else if constexpr (std::is_same_v<T, unsigned long long >) { r =                std::strtoull(s, &e, b ); }
+			else if constexpr (std::is_same_v<T, float              >) { r =                std::strtof  (s, &e    ); }
+			else if constexpr (std::is_same_v<T, double             >) { r =                std::strtod  (s, &e    ); }
+			else if constexpr (std::is_same_v<T, long double        >) { r =                std::strtold (s, &e    ); }
+			else {
+				static_assert([]{ return false; }(), "No specialisation exists for parsing string to T");
+			}
+			
+			return (e == s) ?
+		        std::optional<T>(std::nullopt) :
+				std::optional<T>(r);
+		}
+		
+		/**
+		 * @brief Parses a string into a number using std::from_chars.
+		 *
+		 * Parsing is locale-independent and never reads beyond the bounds of the string.
+		 * A single leading '+' is accepted, for consistency with the C library.
+		 *
+		 * @tparam T The arithmetic type to parse the string into.
+		 * @param[in] _str The string to parse.
+		 * @return An optional value of type T, containing the parsed value if a number was found at the start of the string
+		 * and is representable by T, or an empty optional otherwise.
+		 */
+		template <typename T>
+		static std::optional<T> ParseChars(const std::string_view& _str) noexcept {
+			
+			T r;
+			
+			const char* first = _str.data();
+			const char* last  = _str.data() + _str.size();
+			
+			if (first != last && *first == '+') {
+				++first;
+			}
+			
+			std::from_chars_result result;
+			
+			if constexpr (std::is_integral_v<T>) {
+				result = std::from_chars(first, last, r, 10);
+			}
+			else {
+				result = std::from_chars(first, last, r, std::chars_format::general);
+			}
+			
+			return (result.ec != std::errc()) ?
+		        std::optional<T>(std::nullopt) :
+				std::optional<T>(r);
+		}
+		
+		/**
+		 * @brief Attempts to parse a string into an optional value of type T.
+		 *
+		 * This function attempts to convert the given string into a value of type T.
+		 * If the conversion is successful, the resulting value is wrapped in an optional object and returned.
+		 * If the conversion fails, an empty optional object is returned.
+		 *
+		 * Numbers are parsed with std::from_chars, which is locale-independent and respects the bounds of the string.
+		 * If ATHYG_USE_STRTOD is defined, or the standard library does not implement std::from_chars for floating-point types,
+		 * the C library is used instead.
+		 *
+		 * @tparam T The type of value to parse the string into.
+		 * @param[in] _str The string to parse.
+		 * @return An optional value of type T, containing the parsed value if the conversion is successful, or an empty optional if the conversion fails.
+		 *
+		 * @note The type T must provide a specialize definition of this function in order to support parsing for that type.
+		 *
+		 * @see ParseChars
+		 * @see ParseCString
+		 */
+		template <typename T>
+		static std::optional<T> TryParse(const std::string_view& _str) noexcept {
+			
+			if constexpr (std::is_same_v<T, char         > ||
+			              std::is_same_v<T, unsigned char> ||
+						  std::is_same_v<T, signed char  > ||
+				          std::is_same_v<T, char16_t     > ||
+			              std::is_same_v<T, char32_t     > ||
+	                      std::is_same_v<T, wchar_t      >)
+		    {
+				return _str.empty() ?
+					std::optional<T>(std::nullopt) :
+					std::optional<T>(static_cast<T>(_str[0U]));
+			}
+			else if constexpr (std::is_same_v<T, bool>) {
+				return _str == "true" || _str == "True" || _str == "TRUE" || _str == "T" || _str == "1";
+			}
+			else if constexpr (std::is_integral_v<T>) {
+				
+			#if defined(ATHYG_USE_STRTOD)
+				return ParseCString<T>(_str);
+			#else
+				return ParseChars<T>(_str);
+			#endif
+			}
+			else if constexpr (std::is_floating_point_v<T>) {
+				
+			#if defined(ATHYG_USE_STRTOD) || !defined(__cpp_lib_to_chars)
+				return ParseCString<T>(_str);
+			#else
+				return ParseChars<T>(_str);
+			#endif
+			}
+			else {
+				static_assert([]{ return false; }(), "No specialisation exists for parsing string to T");
+			}
+		}
+		
+		/**
+		 * @brief Parses a field into an empty optional if it is selected by a projection mask.
+		 *
+		 * Strings are copied, and constructed in place. All other types are parsed using TryParse.
+		 *
+		 * @tparam _Mask The projection mask, where bit i selects the field at column index i.
+		 * @tparam _Index The column index of the field.
+		 * @param[out] _value The optional to parse the field into.
+		 * @param[in] _values The fields of the row.
+		 */
+		template <uint64_t _Mask, size_t _Index, typename U, typename S, size_t _Nm>
+		static void Assign(std::optional<U>& _value, const std::array<S, _Nm>& _values) noexcept {
+			
+			if constexpr (((_Mask >> _Index) & 1U) != 0U) {
+				
+				if constexpr (std::is_same_v<U, std::string>) {
+					_value.emplace(_values[_Index]);
+				}
+				else {
+					_value = TryParse<U>(_values[_Index]);
+				}
+			}
+		}
+		
+		/** @brief The tuple of the parsed types of a schema, ordered by column index. */
+		template <typename S>
+		struct TypesOf;
+		
+		template <typename... Ds>
+		struct TypesOf<std::tuple<Ds...>> final {
+			using type = std::tuple<typename Ds::Type...>;
+		};
+		
+		/** @brief Whether a type is an ATHYG version, which is any record type described by a schema. */
+		template <typename T, typename = void>
+		struct IsVersion : std::false_type {};
+		
+		template <typename T>
+		struct IsVersion<T, std::void_t<decltype(T::s_Schema)>> : std::true_type {};
+		
+		/**
+		 * @brief Returns whether the field of every descriptor of the schema of a version equals its position in the schema.
+		 */
+		template <typename T, size_t... Is>
+		static constexpr bool Ordered(std::index_sequence<Is...>) noexcept {
+			return ((static_cast<size_t>(std::get<Is>(T::s_Schema).field) == Is) && ...);
+		}
+		
+		/**
+		 * @brief Parses the fields of a row selected by a projection mask into the members of a record, as described by the schema of its version.
+		 *
+		 * @tparam _Mask The projection mask, where bit i selects the field at column index i.
+		 * @param[out] _record The record, whose members are all empty.
+		 * @param[in] _values The fields of the row.
+		 */
+		template <uint64_t _Mask, typename R, typename S, size_t _Nm, size_t... Is>
+		static void Populate(R& _record, const std::array<S, _Nm>& _values, std::index_sequence<Is...>) noexcept {
+			
+			static_assert(Ordered<R>(std::index_sequence<Is...>()), "Schema must be ordered by column index!");
+			
+			(Assign<_Mask, Is>(_record.*(std::get<Is>(R::s_Schema).member), _values), ...);
+		}
+		
+		/**
+		 * @brief Returns the number of leading fields that must be tokenised to read every field selected by a projection mask.
+		 * @param[in] _mask The projection mask, where bit i selects the field at column index i.
+		 * @return One more than the index of the highest selected field, or 0 if no fields are selected.
+		 */
+		static constexpr size_t Limit(const uint64_t& _mask) noexcept {
+			
+			size_t result = 0U;
+			
+			for (size_t i = 0U; i < 64U; ++i) {
+				
+				if (((_mask >> i) & 1U) != 0U) {
+					result = i + 1U;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Ensures that a vector can hold a number of elements without reallocating.
+		 *
+		 * Unlike std::vector::reserve, the capacity grows geometrically, so repeatedly growing a vector by small amounts takes amortised linear time.
+		 *
+		 * @param[in,out] _vector The vector.
+		 * @param[in] _capacity The number of elements.
+		 */
+		template <typename U>
+		static void Grow(std::vector<U>& _vector, const size_t& _capacity) {
+			
+			if (_capacity > _vector.capacity()) {
+				_vector.reserve(std::max(_capacity, _vector.capacity() * 2U));
+			}
+		}
+		
+		/**
+		 * @struct Unfiltered
+		 * @brief A predicate which accepts every row, used when parsing without a Filter.
+		 */
+		struct Unfiltered final {};
+		
+		/**
+		 * @brief Whether Load, Stream and Export collect per-phase timings and counts of the files they parse (see Options::statistics).
+		 *
+		 * Collection is opt-in, as it reads the clock for every row. Define ATHYG_ENABLE_STATISTICS to collect them. Otherwise, the instrumentation is compiled out.
+		 */
+	#if defined(ATHYG_ENABLE_STATISTICS)
+		static constexpr bool s_Statistics { true };
+	#else
+		static constexpr bool s_Statistics { false };
+	#endif
+		
+		/**
+		 * @brief Returns the statistics requested by the options, or null if none were requested.
+		 * @param[in] _options The options.
+		 * @return The statistics to collect, or null. Always null unless ATHYG_ENABLE_STATISTICS is defined.
+		 * @throw std::runtime_error If statistics were requested but ATHYG_ENABLE_STATISTICS is not defined.
+		 */
+		static Statistics* Instrument(const Options& _options) {
+			
+			if constexpr (s_Statistics) {
+				return _options.statistics;
+			}
+			else {
+				
+				if (_options.statistics != nullptr) {
+					throw std::runtime_error("Collecting statistics requires ATHYG_ENABLE_STATISTICS to be defined!");
+				}
+				
+				return nullptr;
+			}
+		}
+		
+		/**
+		 * @class Timer
+		 * @brief Adds the time between its construction and destruction to a duration. Does nothing if the duration is null, or statistics are disabled.
+		 */
+		class Timer final {
+			
+			std::chrono::nanoseconds* m_Duration;
+			
+			std::chrono::steady_clock::time_point m_Start;
+			
+		public:
+			
+			explicit Timer(std::chrono::nanoseconds* _duration) noexcept :
+				m_Duration(_duration),
+				m_Start()
+			{
+				if constexpr (s_Statistics) {
+					
+					if (m_Duration != nullptr) {
+						m_Start = std::chrono::steady_clock::now();
+					}
+				}
+			}
+			
+			Timer(const Timer&) = delete;
+			Timer& operator = (const Timer&) = delete;
+			
+			~Timer() {
+				
+				if constexpr (s_Statistics) {
+					
+					if (m_Duration != nullptr) {
+						*m_Duration += std::chrono::steady_clock::now() - m_Start;
+					}
+				}
+			}
+		};
+		
+		/**
+		 * @struct Errata
+		 * @brief The malformed rows of a chunk, as reported by Parse under the Skip and Collect error policies.
+		 *
+		 * Rows are recorded by their offset from the start of the chunk, and are located within their file by a Locator once the chunk is parsed.
+		 */
+		struct Errata final {
+			
+			/** @brief The number of malformed rows. */
+			uint64_t count { 0U };
+			
+			/** @brief The maximum number of malformed rows to record. */
+			size_t capacity { 0U };
+			
+			/** @brief The malformed rows recorded, with the offset of each relative to the start of the chunk. */
+			std::vector<Diagnostic> entries;
+		};
+		
+		/**
+		 * @class Locator
+		 * @brief Tracks the position of each parsed block within its file, to add the malformed rows of its chunks to the diagnostics of the options.
+		 *
+		 * Does nothing under the Throw error policy.
+		 *
+		 * @tparam E The error policy.
+		 */
+		template <Errors E>
+		class Locator final {
+			
+			Diagnostics* m_Diagnostics;
+			
+			/** @brief The malformed rows of each chunk of the current block. */
+			std::vector<Errata> m_Parts;
+			
+			std::filesystem::path m_Path;
+			
+			/** @brief The line number and offset of the start of the current block. The line is only counted while rows are being recorded. */
+			uint64_t m_Line;
+			uint64_t m_Offset;
+			
+			/** @brief The number of malformed rows discarded. */
+			uint64_t m_Count;
+			
+		public:
+			
+			explicit Locator(Diagnostics* const _diagnostics) noexcept :
+				m_Diagnostics(_diagnostics),
+				m_Parts(),
+				m_Path(),
+				m_Line(0U),
+				m_Offset(0U),
+				m_Count(0U) {}
+			
+			/** @brief Starts a file. */
+			void Open(const std::filesystem::path& _path) {
+				
+				if constexpr (E != Errors::Throw) {
+					m_Path   = _path;
+					m_Line   = 2U;
+					m_Offset = 0U;
+				}
+			}
+			
+			/** @brief Skips the header of the current file, excluding its newline. */
+			void Header(const std::string_view& _header) noexcept {
+				
+				if constexpr (E != Errors::Throw) {
+					m_Offset = _header.size() + 1U;
+				}
+			}
+			
+			/** @brief Prepares to parse a block, split into a number of chunks. */
+			void Prepare(const size_t& _chunks) {
+				
+				if constexpr (E != Errors::Throw) {
+					
+					Errata part;
+					
+					if constexpr (E == Errors::Collect) {
+						part.capacity = m_Diagnostics != nullptr ? m_Diagnostics->capacity : 0U;
+					}
+					
+					m_Parts.assign(_chunks, part);
+				}
+			}
+			
+			/** @brief Returns the errata to pass to Parse for a chunk of the current block, or null under the Throw error policy. */
+			[[nodiscard]] Errata* Part(const size_t& _chunk) noexcept {
+				
+				if constexpr (E != Errors::Throw) {
+					return &m_Parts[_chunk];
+				}
+				else {
+					static_cast<void>(_chunk);
+					return nullptr;
+				}
+			}
+			
+			/**
+			 * @brief Adds the malformed rows of every chunk of the current block to the diagnostics, in order, then moves past the block.
+			 * @param[in] _block The block.
+			 * @param[in] _chunks The chunks of the block, in order, one for each errata.
+			 */
+			void Commit(const std::string_view& _block, const std::string_view* const _chunks) {
+				
+				if constexpr (E != Errors::Throw) {
+					
+					for (size_t i = 0U; i < m_Parts.size(); ++i) {
+						
+						auto& part = m_Parts[i];
+						
+						const auto& chunk = _chunks[i];
+						
+						const auto offset = m_Offset + static_cast<uint64_t>(chunk.data() - _block.data());
+						
+						m_Count += part.count;
+						
+						if (m_Diagnostics != nullptr) {
+							
+							m_Diagnostics->count += part.count;
+							
+							// Lines no longer matter once the diagnostics are full.
+							if (m_Diagnostics->entries.size() >= m_Diagnostics->capacity) {
+								continue;
+							}
+							
+							// Count newlines rather than rows, as quoted fields may span several lines.
+							size_t counted = 0U;
+							
+							for (auto& entry : part.entries) {
+								
+								if (m_Diagnostics->entries.size() >= m_Diagnostics->capacity) {
+									break;
+								}
+								
+								m_Line += static_cast<uint64_t>(std::count(chunk.data() + counted, chunk.data() + entry.offset, '\n'));
+								counted = static_cast<size_t>(entry.offset);
+								
+								entry.path    = m_Path;
+								entry.line    = m_Line;
+								entry.offset += offset;
+								
+								m_Diagnostics->entries.push_back(std::move(entry));
+							}
+							
+							m_Line += static_cast<uint64_t>(std::count(chunk.data() + counted, chunk.data() + chunk.size(), '\n'));
+						}
+					}
+					
+					m_Offset += _block.size();
+				}
+			}
+			
+			/**
+			 * @brief Returns the number of malformed rows discarded.
+			 * @return The number of malformed rows.
+			 */
+			[[nodiscard]] uint64_t Count() const noexcept {
+				return m_Count;
+			}
+		};
+		
+		/** @brief The maximum number of columns of a header that are mapped to fields. Columns beyond it are ignored. */
+		static constexpr size_t s_MaxColumns { 64U };
+		
+		/** @brief The column index of a field which is not present in the header. */
+		static constexpr size_t s_Missing { std::numeric_limits<size_t>::max() };
+		
+		/**
+		 * @struct Layout
+		 * @brief The column index of each field of an ATHYG version within a CSV file, as read from its header.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 */
+		template <typename T>
+		struct Layout final {
+			
+			/** @brief The column index of each field, or s_Missing if the field is not present. */
+			std::array<size_t, T::s_ElementCount> columns;
+			
+			/** @brief The number of columns in the header, which every row must have. */
+			size_t count;
+			
+			/** @brief Whether the header begins with every field of the version in order, so fields can be read from fixed positions. */
+			bool fixed;
+			
+			constexpr Layout() noexcept :
+				columns(),
+				count(T::s_ElementCount),
+				fixed(true)
+			{
+				for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+					columns[i] = i;
+				}
+			}
+		};
+		
+		/**
+		 * @brief Maps the fields of an ATHYG version to the columns of a CSV file by name.
+		 *
+		 * Columns are matched to fields by the names in T::s_Names. Unknown columns are ignored,
+		 * and fields without a column are treated as empty, unless they are required.
+		 * A leading UTF-8 byte order mark and quotes around column names are ignored.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @param[in] _header The header of the CSV file, excluding the newline.
+		 * @param[in] _required A mask of the fields which must be present, where bit i selects the field at column index i.
+		 * @return The layout of the file.
+		 * @throw std::runtime_error If a required field is not present in the header.
+		 */
+		template <typename T>
+		static Layout<T> Map(std::string_view _header, const uint64_t& _required) {
+			
+			constexpr std::string_view bom("\xEF\xBB\xBF");
+			
+			if (_header.substr(0U, bom.size()) == bom) {
+				_header.remove_prefix(bom.size());
+			}
+			
+			std::array<std::string_view, s_MaxColumns> names;
+			
+			Layout<T> result;
+			result.count = 0U;
+			
+			Scanner::Rows<s_MaxColumns>(_header, [&names, &result](const std::array<std::string_view, s_MaxColumns>& _names, const size_t& _count) noexcept {
+				names        = _names;
+				result.count = _count;
+			});
+			
+			const auto stored = std::min(result.count, s_MaxColumns);
+			
+			for (size_t i = 0U; i < stored; ++i) {
+				
+				auto& name = names[i];
+				
+				if (name.size() >= 2U && name.front() == '"' && name.back() == '"') {
+					name = name.substr(1U, name.size() - 2U);
+				}
+			}
+			
+			// Headers which begin with the known layout are read from fixed positions, exactly as if there were no header.
+			result.fixed = stored >= T::s_ElementCount;
+			
+			for (size_t i = 0U; i < T::s_ElementCount && result.fixed; ++i) {
+				result.fixed = names[i] == T::s_Names[i];
+			}
+			
+			if (!result.fixed) {
+				
+				for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+					
+					const auto column = std::find(names.begin(), names.begin() + stored, T::s_Names[i]);
+					
+					result.columns[i] = column == names.begin() + stored ?
+						s_Missing :
+						static_cast<size_t>(column - names.begin());
+					
+					if (result.columns[i] == s_Missing && ((_required >> i) & 1U) != 0U) {
+						throw std::runtime_error("Header is missing the \"" + std::string(T::s_Names[i]) + "\" column!");
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Deserialises the rows of an ATHYG CSV file held in memory.
+		 *
+		 * Lines are tokenised directly over the provided buffer using the Scanner, so no bytes are copied before field parsing.
+		 * Elements beyond the count used by the ATHYG version are discarded. The buffer must not contain the header.
+		 *
+		 * Only the fields selected by the projection are converted, and fields beyond the last selected field are not tokenised (only counted).
+		 * If a filter is given, rows which do not satisfy it are discarded once tokenised, and only the fields it tests are converted for them.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P The projection of fields to parse.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 * @tparam Container The type of the result. Either std::vector<T> or Catalogue<T>.
+		 * @tparam Predicate The type of the filter. Either Unfiltered or Filter<T>.
+		 * @param[in] _rows The rows of the CSV file.
+		 * @param[in,out] _result The container to append the deserialised rows to.
+		 * @param[in] _layout (optional) The layout of the file, as read from its header. Defaults to the known layout of the ATHYG version.
+		 * @param[in] _filter (optional) The filter each row must satisfy to be deserialised.
+		 * @param[in,out] _statistics (optional) The statistics to add the timings and counts of the rows to. Nothing is collected if null.
+		 * @param[in,out] _errata (optional) The errata to add the malformed rows to, under the Skip and Collect error policies.
+		 * @throw std::runtime_error If the number of elements in a CSV line
+		 * is not consistent with the ATHYG version, under the Throw error policy.
+		 *
+		 * @note Trailing carriage returns are stripped, so files with Windows line endings are supported.
+		 * @note Files with the known layout are read from fixed positions. Otherwise, each row is tokenised in full and its fields are gathered by column index, which is slower.
+		 */
+		template <typename T, typename P, Errors E = Errors::Throw, typename Container, typename Predicate = Unfiltered>
+		static void Parse(const std::string_view& _rows, Container& _result, const Layout<T>& _layout = Layout<T>(), const Predicate& _filter = Predicate(), Statistics* const _statistics = nullptr, Errata* const _errata = nullptr) {
+			
+			constexpr auto mask     = P::s_Mask;
+			constexpr bool filtered = !std::is_same_v<Predicate, Unfiltered>;
+			
+			// All time spent in this function is counted as tokenising, except the time spent converting each row, which is moved from it.
+			const Timer timer(_statistics != nullptr ? &_statistics->tokenise : nullptr);
+			
+			if constexpr (s_Statistics) {
+				
+				if (_statistics != nullptr && _statistics->nulls.size() < T::s_ElementCount) {
+					_statistics->nulls.resize(T::s_ElementCount, 0U);
+				}
+			}
+			
+			// Pre-size the result so that it never reallocates while parsing. Filtered rows are typically sparse, so are not reserved for.
+			if constexpr (!filtered) {
+				
+				const auto capacity = Scanner::Count(_rows);
+				
+				if constexpr (std::is_same_v<Container, std::vector<T>>) {
+					Grow(_result, _result.size() + capacity);
+				}
+				else {
+					_result.template Reserve<mask>(_result.Size() + capacity);
+				}
+			}
+			
+			const auto emplace = [&_result, &_filter, _statistics](const std::array<std::string_view, T::s_ElementCount>& _elements) {
+				
+				if constexpr (s_Statistics) {
+					
+					if (_statistics != nullptr) {
+						++_statistics->rows;
+					}
+				}
+				
+				if constexpr (filtered) {
+					
+					// Discard the row before converting any field that is not tested by the filter.
+					if (!_filter(_elements)) {
+						
+						if constexpr (s_Statistics) {
+							
+							if (_statistics != nullptr) {
+								++_statistics->rejected;
+							}
+						}
+						
+						return;
+					}
+				}
+				else {
+					static_cast<void>(_filter);
+				}
+				
+				std::chrono::steady_clock::time_point start;
+				
+				if constexpr (s_Statistics) {
+					
+					if (_statistics != nullptr) {
+						
+						for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+							_statistics->nulls[i] += static_cast<uint64_t>(((mask >> i) & 1U) != 0U && _elements[i].empty());
+						}
+						
+						start = std::chrono::steady_clock::now();
+					}
+				}
+				
+				// Deserialise the star.
+				if constexpr (std::is_same_v<Container, std::vector<T>>) {
+					_result.emplace_back(_elements, std::integral_constant<uint64_t, mask>());
+				}
+				else {
+					_result.template Emplace<mask>(_elements);
+				}
+				
+				if constexpr (s_Statistics) {
+					
+					if (_statistics != nullptr) {
+						
+						const auto elapsed = std::chrono::steady_clock::now() - start;
+						
+						_statistics->convert  += elapsed;
+						_statistics->tokenise -= elapsed;
+					}
+				}
+			};
+			
+			// Applies the error policy to a malformed row, given its first field. Only reached for malformed rows, so never slows the others.
+			const auto malformed = [&_rows, _statistics, _errata](const std::string_view& _first, const std::string_view& _reason) {
+				
+				if constexpr (E == Errors::Throw) {
+					static_cast<void>(_rows);
+					static_cast<void>(_statistics);
+					static_cast<void>(_errata);
+					static_cast<void>(_first);
+					
+					throw std::runtime_error(std::string(_reason));
+				}
+				else {
+					
+					if constexpr (s_Statistics) {
+						
+						if (_statistics != nullptr) {
+							++_statistics->malformed;
+						}
+					}
+					
+					if (_errata != nullptr) {
+						
+						if constexpr (E == Errors::Collect) {
+							
+							if (_errata->entries.size() < _errata->capacity) {
+								// The line is counted by the Locator, from the offset.
+								_errata->entries.push_back({ std::filesystem::path(), 0U, static_cast<uint64_t>(_first.data() - _rows.data()), _reason });
+							}
+						}
+						
+						++_errata->count;
+					}
+				}
+			};
+			
+			if (!_layout.fixed) {
+				
+				// Gather the fields of each row from the columns given by the header. Fields without a column are empty.
+				Scanner::Rows<s_MaxColumns>(_rows, [&_layout, &emplace, &malformed](const std::array<std::string_view, s_MaxColumns>& _columns, const size_t& _count) {
+					
+					if (_count < _layout.count) {
+						malformed(_columns[0U], "Number of elements not consistent with header!");
+						return;
+					}
+					
+					std::array<std::string_view, T::s_ElementCount> elements;
+					
+					for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+						
+						if (_layout.columns[i] != s_Missing) {
+							elements[i] = _columns[_layout.columns[i]];
+						}
+					}
+					
+					emplace(elements);
+				});
+				
+				return;
+			}
+			
+			const auto row = [&emplace, &malformed](const std::array<std::string_view, T::s_ElementCount>& _elements, const size_t& _count) {
+				
+				// Validate number of elements matches the count expected by the ATHYG version.
+				if (_count >= T::s_ElementCount) {
+					emplace(_elements);
+				}
+				else {
+					malformed(_elements[0U], "Number of elements not consistent with ATHYG version!");
+				}
+			};
+			
+			// Process CSV elements:
+			if constexpr (filtered) {
+				
+				// Fields tested by the filter must be tokenised even if they are beyond the projection.
+				if (_filter.Limit() > Limit(mask)) {
+					Scanner::Rows<T::s_ElementCount>(_rows, row);
+					return;
+				}
+			}
+			
+			// At least the first field is stored, as it locates the row if it is malformed.
+			Scanner::Rows<T::s_ElementCount, std::max(Limit(mask), static_cast<size_t>(1U))>(_rows, row);
+		}
+		
+		/**
+		 * @class Packer
+		 * @brief Packs the fields of stars into interleaved vertices, for Export.
+		 *
+		 * Implements the part of the interface of Catalogue used by Parse, so rows are packed as they are tokenised, without constructing any star.
+		 * Vertices are written to a buffer provided by the caller, or to storage owned by the packer (at the stride of the layout) if none is given.
+		 *
+		 * @tparam I The Interleaved layout of each vertex.
+		 */
+		template <typename I>
+		class Packer final {
+			
+			using U = typename I::Type;
+			
+			unsigned char* m_Data;
+			size_t         m_Capacity;
+			size_t         m_Stride;
+			Missing        m_Missing;
+			size_t         m_Size;
+			
+			std::vector<unsigned char> m_Storage;
+			
+		public:
+			
+			/**
+			 * @brief Creates a packer which writes to storage it owns.
+			 * @param[in] _missing The policy for fields without a value.
+			 */
+			explicit Packer(const Missing& _missing) noexcept :
+				m_Data(nullptr),
+				m_Capacity(std::numeric_limits<size_t>::max()),
+				m_Stride(I::s_Stride),
+				m_Missing(_missing),
+				m_Size(0U),
+				m_Storage() {}
+			
+			/**
+			 * @brief Creates a packer which writes to a buffer.
+			 * @param[in] _data The buffer.
+			 * @param[in] _size The size of the buffer in bytes.
+			 * @param[in] _stride The distance between the start of consecutive vertices in bytes. Bytes between vertices are not written.
+			 * @param[in] _missing The policy for fields without a value.
+			 * @throw std::runtime_error If the stride is less than the size of a vertex.
+			 */
+			Packer(void* _data, const size_t& _size, const size_t& _stride, const Missing& _missing) :
+				m_Data(static_cast<unsigned char*>(_data)),
+				m_Capacity(_size >= I::s_Stride ? ((_size - I::s_Stride) / std::max(_stride, static_cast<size_t>(1U))) + 1U : 0U),
+				m_Stride(_stride),
+				m_Missing(_missing),
+				m_Size(0U),
+				m_Storage()
+			{
+				if (_stride < I::s_Stride) {
+					throw std::runtime_error("Stride must not be less than the size of a vertex!");
+				}
+			}
+			
+			/**
+			 * @brief Packs a vertex from the value of each field of the layout, according to the policy for missing values.
+			 * @param[in] _values The value of each field, in the order of the layout.
+			 * @throw std::runtime_error If the buffer is full.
+			 */
+			void Push(const std::array<std::optional<double>, I::s_Count>& _values) {
+				
+				std::array<U, I::s_Count> vertex;
+				
+				for (size_t i = 0U; i < I::s_Count; ++i) {
+					
+					if (_values[i].has_value()) {
+						vertex[i] = static_cast<U>(*_values[i]);
+					}
+					else if (m_Missing == Missing::Zero) {
+						vertex[i] = static_cast<U>(0);
+					}
+					else if (m_Missing == Missing::NaN) {
+						vertex[i] = std::numeric_limits<U>::quiet_NaN();
+					}
+					else {
+						return;
+					}
+				}
+				
+				if (m_Size == m_Capacity) {
+					throw std::runtime_error("Buffer is too small for the exported stars!");
+				}
+				
+				// Vertices are written whole and in order, which suits write-combined memory such as a mapped GPU buffer.
+				if (m_Data != nullptr) {
+					std::memcpy(m_Data + (m_Size * m_Stride), vertex.data(), sizeof(vertex));
+				}
+				else {
+					m_Storage.resize(m_Storage.size() + sizeof(vertex));
+					std::memcpy(m_Storage.data() + m_Storage.size() - sizeof(vertex), vertex.data(), sizeof(vertex));
+				}
+				
+				++m_Size;
+			}
+			
+			/**
+			 * @brief Copies the vertices of a packer which owns its storage.
+			 * @param[in] _other The packer.
+			 * @throw std::runtime_error If the buffer is full.
+			 */
+			void Append(const Packer& _other) {
+				
+				if (_other.m_Size > m_Capacity - m_Size) {
+					throw std::runtime_error("Buffer is too small for the exported stars!");
+				}
+				
+				if (m_Data != nullptr && m_Stride == I::s_Stride) {
+					std::memcpy(m_Data + (m_Size * m_Stride), _other.m_Storage.data(), _other.m_Storage.size());
+				}
+				else if (m_Data != nullptr) {
+					
+					for (size_t i = 0U; i < _other.m_Size; ++i) {
+						std::memcpy(m_Data + ((m_Size + i) * m_Stride), _other.m_Storage.data() + (i * I::s_Stride), I::s_Stride);
+					}
+				}
+				else {
+					m_Storage.insert(m_Storage.end(), _other.m_Storage.begin(), _other.m_Storage.end());
+				}
+				
+				m_Size += _other.m_Size;
+			}
+			
+			/** @brief Discards every vertex, keeping the capacity of owned storage. */
+			void Clear() noexcept {
+				m_Size = 0U;
+				m_Storage.clear();
+			}
+			
+			template <uint64_t _Mask>
+			void Reserve(const size_t& _capacity) {
+				
+				if (m_Data == nullptr) {
+					Grow(m_Storage, _capacity * I::s_Stride);
+				}
+			}
+			
+			template <uint64_t _Mask, typename S, size_t _Nm>
+			void Emplace(const std::array<S, _Nm>& _values) {
+				
+				std::array<std::optional<double>, I::s_Count> values;
+				
+				for (size_t i = 0U; i < I::s_Count; ++i) {
+					values[i] = TryParse<double>(_values[I::s_Fields[i]]);
+				}
+				
+				Push(values);
+			}
+			
+			/**
+			 * @brief Returns the number of vertices written.
+			 * @return The number of vertices.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Size;
+			}
+		};
+		
+		/**
+		 * @brief Reads and deserialises ATHYG CSV files into a container.
+		 *
+		 * Implements Load for both row-oriented (std::vector<T>) and columnar (Catalogue<T>) results.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P The projection of fields to parse.
+		 * @tparam Container The type of the result. Either std::vector<T> or Catalogue<T>.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 * @tparam Predicate The type of the filter. Either Unfiltered or Filter<T>.
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[in] _filter (optional) The filter each row must satisfy to be deserialised.
+		 * @param[in] _fingerprint (optional) Whether to hash every file, and record it as an Input of a Catalogue, so that a binary cache or Reload can detect when it changes.
+		 * @return A container holding the deserialised rows of every file, in file order, then row order.
+		 *
+		 * @see Load(const std::vector<std::filesystem::path>&, const Options&)
+		 */
+		template <typename T, typename P, typename Container, Errors E = Errors::Throw, typename Predicate = Unfiltered>
+		static Container Read(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, const Predicate& _filter = Predicate(), const bool& _fingerprint = false) {
+			
+			static_assert(IsVersion<T>::value, "Template argument must be an ATHYG version!");
+			
+			static_assert(std::is_same_v<typename P::Version, T>, "Projection must select fields of the same ATHYG version!");
+			
+			constexpr bool rows = std::is_same_v<Container, std::vector<T>>;
+			
+			for (const auto& path : _athyg_paths) {
+				
+				if (!exists(path)) {
+					throw std::runtime_error("Path is not valid.");
+				}
+			}
+			
+			const auto threads = _options.threads == 0U ?
+				std::max(std::thread::hardware_concurrency(), 1U) :
+				_options.threads;
+			
+			const auto chunk_size = std::max(_options.chunk_size, static_cast<size_t>(1U));
+			
+			// Whether the result is sized exactly by the merge of a single block.
+			[[maybe_unused]] const bool exact = _options.numa && _options.source == Source::Mapped && _athyg_paths.size() == 1U;
+			
+			// Merged result
+			Container result;
+			
+			if constexpr (!rows) {
+				result.m_Mask = P::s_Mask;
+			}
+			
+			auto* const statistics = Instrument(_options);
+			
+			// Reads and parses one file into a container, using a number of threads.
+			const auto load = [&](const std::filesystem::path& _path, Container& _result, const size_t& _threads, Locator<E>& _locator, Statistics* const _statistics) {
+				
+				// Mapped files are resident in full regardless, so are parsed in a single pass, which also allows the result to be sized exactly.
+				// Otherwise, files are parsed in blocks of one chunk per thread while the next blocks are read.
+				const auto window = _options.source == Source::Mapped ?
+					std::numeric_limits<size_t>::max() :
+					chunk_size * _threads;
+				
+				// Parsed chunks of the current block, merged into the result in order.
+				std::vector<Container> parsed;
+				
+				// Statistics of each chunk of the current block, added to the total once the block is parsed.
+				std::vector<Statistics> parts;
+				
+				Hasher hasher;
+				
+				size_t before;
+				
+				if constexpr (rows) {
+					before = _result.size();
+				}
+				else {
+					before = _result.Size();
+				}
+				
+				const auto size = static_cast<uint64_t>(file_size(_path));
+				
+				bool first = true;
+				
+				Layout<T> layout;
+				
+				const auto header = [&layout, &_locator, &_filter, &_fingerprint, &hasher](const std::string_view& _header) {
+					
+					_locator.Header(_header);
+					
+					// The header decides which column each field is read from, so is part of the identity of the file.
+					if (_fingerprint) {
+						hasher.Update(_header);
+						hasher.Update("\n");
+					}
+					
+					if constexpr (std::is_same_v<Predicate, Unfiltered>) {
+						static_cast<void>(_filter);
+						layout = Map<T>(_header, P::s_Mask);
+					}
+					else {
+						layout = Map<T>(_header, P::s_Mask | _filter.Mask());
+					}
+				};
+				
+				// The time spent reading is the time spent in ReadBlocks, less the time spent processing each block.
+				const auto start = s_Statistics && _statistics != nullptr ?
+					std::chrono::steady_clock::now() :
+					std::chrono::steady_clock::time_point();
+				
+				std::chrono::nanoseconds busy { 0 };
+				
+				_locator.Open(_path);
+				
+				ReadBlocks(_path, _options.source, window, header, [&](const std::string_view& _block) {
+					
+					const Timer processing(_statistics != nullptr ? &busy : nullptr);
+					
+					if (_fingerprint) {
+						hasher.Update(_block);
+					}
+					
+					if (_statistics != nullptr) {
+						_statistics->bytes += _block.size();
+					}
+					
+					// Extrapolate the number of rows of the file from its first block, so the result is usually sized once per file.
+					if (first && _options.source != Source::Mapped && !_block.empty()) {
+						
+						const auto estimate = before + static_cast<size_t>(static_cast<double>(Scanner::Count(_block)) * 1.01 *
+							(static_cast<double>(size) / static_cast<double>(_block.size())));
+						
+						if constexpr (rows) {
+							_result.reserve(estimate);
+						}
+						else {
+							_result.template Reserve<P::s_Mask>(estimate);
+						}
+					}
+					
+					first = false;
+					
+					if (_threads == 1U) {
+						
+						_locator.Prepare(1U);
+						
+						Parse<T, P, E>(_block, _result, layout, _filter, _statistics, _locator.Part(0U));
+						
+						_locator.Commit(_block, &_block);
+					}
+					else {
+						
+						// Split the block into chunks, and parse each chunk in parallel:
+						const auto chunks = Chunk(_block, chunk_size);
+						
+						parsed.resize(chunks.size());
+						
+						if (_statistics != nullptr) {
+							parts.assign(chunks.size(), Statistics());
+						}
+						
+						_locator.Prepare(chunks.size());
+						
+						const auto parse = [&](const size_t& _i) {
+							Parse<T, P, E>(chunks[_i], parsed[_i], layout, _filter, _statistics != nullptr ? &parts[_i] : nullptr, _locator.Part(_i));
+						};
+						
+						if (_options.numa) {
+							NodeFor(chunks.size(), _threads, parse);
+						}
+						else {
+							ParallelFor(chunks.size(), _threads, parse);
+						}
+						
+						_locator.Commit(_block, chunks.data());
+						
+						for (const auto& part : parts) {
+							*_statistics += part;
+						}
+						
+						const Timer merging(_statistics != nullptr ? &_statistics->construct : nullptr);
+						
+						// Merge the results in row order:
+						size_t count = 0U;
+						for (const auto& part : parsed) {
+							
+							if constexpr (rows) {
+								count += part.size();
+							}
+							else {
+								count += part.Size();
+							}
+						}
+						
+						if constexpr (rows) {
+							Grow(_result, _result.size() + count);
+						}
+						else {
+							
+							// Place the result before the merge first touches it, which is only final if the block is the whole of the result.
+							if (exact) {
+								_result.template Reserve<P::s_Mask>(_result.Size() + count, parsed);
+								_result.Place(_result.Size() + count);
+							}
+							else {
+								_result.template Reserve<P::s_Mask>(_result.Size() + count);
+							}
+						}
+						
+						for (auto& part : parsed) {
+							
+							if constexpr (rows) {
+								
+								for (auto& star : part) {
+									_result.emplace_back(std::move(star));
+								}
+							}
+							else {
+								_result.Merge(std::move(part));
+							}
+							
+							// Release the memory of each part as soon as it is merged.
+							part = Container();
+						}
+					}
+					
+					return true;
+				});
+				
+				if constexpr (!rows) {
+					
+					if (_fingerprint) {
+						_result.m_Inputs.push_back({ size, hasher.Digest(), _result.Size() - before });
+					}
+				}
+				else {
+					static_cast<void>(before);
+				}
+				
+				if constexpr (s_Statistics) {
+					
+					if (_statistics != nullptr) {
+						_statistics->read += (std::chrono::steady_clock::now() - start) - busy;
+						++_statistics->files;
+					}
+				}
+			};
+			
+			// The number of malformed rows discarded.
+			uint64_t malformed;
+			
+			// Files are read, decompressed and parsed concurrently, each by an equal share of the threads, then merged in file order.
+			const auto concurrent = std::min(_athyg_paths.size(), static_cast<size_t>(threads));
+			
+			if (concurrent <= 1U) {
+				
+				Locator<E> locator(_options.diagnostics);
+				
+				for (const auto& path : _athyg_paths) {
+					load(path, result, threads, locator, statistics);
+				}
+				
+				malformed = locator.Count();
+			}
+			else {
+				
+				const auto share = std::max(threads / concurrent, static_cast<size_t>(1U));
+				
+				std::vector<Container> files(_athyg_paths.size());
+				
+				// The malformed rows and statistics of each file, added to those of the options in file order.
+				std::vector<Diagnostics> diagnostics(_athyg_paths.size());
+				std::vector<Locator<E>>  locators;
+				std::vector<Statistics>  totals(statistics != nullptr ? _athyg_paths.size() : 0U);
+				
+				locators.reserve(_athyg_paths.size());
+				
+				for (auto& item : diagnostics) {
+					
+					item.capacity = _options.diagnostics != nullptr ? _options.diagnostics->capacity : 0U;
+					
+					locators.emplace_back(_options.diagnostics != nullptr ? &item : nullptr);
+				}
+				
+				ParallelFor(_athyg_paths.size(), concurrent, [&](const size_t& _i) {
+					load(_athyg_paths[_i], files[_i], share, locators[_i], statistics != nullptr ? &totals[_i] : nullptr);
+				});
+				
+				for (const auto& total : totals) {
+					*statistics += total;
+				}
+				
+				const Timer merging(statistics != nullptr ? &statistics->construct : nullptr);
+				
+				size_t count = 0U;
+				for (const auto& file : files) {
+					
+					if constexpr (rows) {
+						count += file.size();
+					}
+					else {
+						count += file.Size();
+					}
+				}
+				
+				if constexpr (rows) {
+					Grow(result, count);
+				}
+				else {
+					result.template Reserve<P::s_Mask>(count);
+				}
+				
+				malformed = 0U;
+				
+				for (size_t i = 0U; i < files.size(); ++i) {
+					
+					if constexpr (rows) {
+						
+						for (auto& star : files[i]) {
+							result.emplace_back(std::move(star));
+						}
+					}
+					else {
+						result.Merge(std::move(files[i]));
+					}
+					
+					// Release the memory of each file as soon as it is merged.
+					files[i] = Container();
+					
+					malformed += locators[i].Count();
+					
+					if (_options.diagnostics != nullptr) {
+						
+						_options.diagnostics->count += diagnostics[i].count;
+						
+						for (auto& entry : diagnostics[i].entries) {
+							
+							if (_options.diagnostics->entries.size() >= _options.diagnostics->capacity) {
+								break;
+							}
+							
+							_options.diagnostics->entries.push_back(std::move(entry));
+						}
+					}
+				}
+			}
+			
+			if constexpr (!rows && !std::is_same_v<Predicate, Unfiltered>) {
+				
+				// A filtered catalogue does not hold every row of its files, so must not be mistaken for them by a binary cache.
+				result.m_Inputs.clear();
+			}
+			
+			if constexpr (!rows && E != Errors::Throw) {
+				
+				// Likewise for a catalogue missing malformed rows.
+				if (malformed != 0U) {
+					result.m_Inputs.clear();
+				}
+			}
+			
+			if constexpr (!rows) {
+				
+				if (_options.numa) {
+					result.Place(result.Size());
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @struct Input
+		 * @brief Identifies a source file of a catalogue, so that a binary cache can detect when it has changed.
+		 */
+		struct Input final {
+			
+			/** @brief The size of the file on disk, in bytes. */
+			uint64_t size;
+			
+			/** @brief The hash of the header and rows of the file, after decompression. */
+			uint64_t hash;
+			
+			/** @brief The number of rows deserialised from the file. */
+			uint64_t rows;
+		};
+		
+		/** @brief The first bytes of every binary cache file. */
+		static constexpr std::array<char, 8U> s_CacheMagic { 'A', 'T', 'H', 'Y', 'G', 'B', 'I', 'N' };
+		
+		/** @brief The revision of the binary cache layout. Caches of a different revision are rejected. */
+		static constexpr uint32_t s_CacheFormat { 3U };
+		
+		/**
+		 * @class BinaryWriter
+		 * @brief Writes little-endian binary data to a file.
+		 *
+		 * Arrays may be aligned to 8 bytes relative to the start of the file, so that they can be read in place once the file is mapped.
+		 */
+		class BinaryWriter final {
+			
+			std::ofstream m_Stream;
+			size_t        m_Offset;
+			
+		public:
+			
+			/**
+			 * @brief Creates (or truncates) the file at the given path.
+			 * @param[in] _path The path to the file.
+			 * @throws std::runtime_error If the file cannot be opened.
+			 */
+			explicit BinaryWriter(const std::filesystem::path& _path) :
+				m_Stream(_path, std::ios::out | std::ios::binary | std::ios::trunc),
+				m_Offset(0U)
+			{
+				if (!m_Stream.is_open()) {
+					throw std::runtime_error("Failed to open \"" + _path.string() + "\" for writing.");
+				}
+			}
+			
+			void Bytes(const void* _data, const size_t& _size) {
+				
+				if (_size != 0U) {
+					m_Stream.write(static_cast<const char*>(_data), static_cast<std::streamsize>(_size));
+					m_Offset += _size;
+				}
+			}
+			
+			void Align() {
+				
+				constexpr std::array<char, 8U> padding {};
+				
+				Bytes(padding.data(), (8U - (m_Offset % 8U)) % 8U);
+			}
+			
+			template <typename U>
+			void Array(const U* _data, const size_t& _count) {
+				
+				if constexpr (s_BigEndian && sizeof(U) > 1U) {
+					
+					for (size_t i = 0U; i < _count; ++i) {
+						
+						const auto value = ByteSwap(_data[i]);
+						
+						Bytes(&value, sizeof(U));
+					}
+				}
+				else {
+					Bytes(_data, _count * sizeof(U));
+				}
+			}
+			
+			template <typename U>
+			void Value(const U& _value) {
+				Array(&_value, 1U);
+			}
+			
+			/**
+			 * @brief Writes the header of a column.
+			 * @param[in] _kind The kind of the column.
+			 * @param[in] _width The width of each value of the column, in bytes.
+			 * @param[in] _size The number of rows of the column.
+			 */
+			void Column(const char& _kind, const size_t& _width, const size_t& _size) {
+				Value(static_cast<uint32_t>(_kind));
+				Value(static_cast<uint32_t>(_width));
+				Value(static_cast<uint64_t>(_size));
+			}
+			
+			/**
+			 * @brief Flushes and closes the file.
+			 * @throws std::runtime_error If any write failed.
+			 */
+			void Close() {
+				
+				m_Stream.close();
+				
+				if (m_Stream.fail()) {
+					throw std::runtime_error("Failed to write binary cache!");
+				}
+			}
+		};
+		
+		/**
+		 * @class BinaryReader
+		 * @brief Reads little-endian binary data written by a BinaryWriter from a buffer, with bounds checking.
+		 */
+		class BinaryReader final {
+			
+			std::string_view m_Data;
+			size_t           m_Offset;
+			
+		public:
+			
+			explicit BinaryReader(const std::string_view& _data) noexcept :
+				m_Data(_data),
+				m_Offset(0U) {}
+			
+			/**
+			 * @brief Consumes a number of bytes.
+			 * @param[in] _size The number of bytes.
+			 * @return A view over the consumed bytes.
+			 * @throws std::runtime_error If fewer bytes remain.
+			 */
+			std::string_view Bytes(const size_t& _size) {
+				
+				if (_size > m_Data.size() - m_Offset) {
+					throw std::runtime_error("Unexpected end of binary cache!");
+				}
+				
+				const auto result = m_Data.substr(m_Offset, _size);
+				
+				m_Offset += _size;
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Returns the number of bytes which have not been consumed.
+			 * @return The number of bytes.
+			 */
+			[[nodiscard]] size_t Remaining() const noexcept {
+				return m_Data.size() - m_Offset;
+			}
+			
+			void Align() {
+				Bytes((8U - (m_Offset % 8U)) % 8U);
+			}
+			
+			template <typename U>
+			void Array(U* _data, const size_t& _count) {
+				
+				const auto bytes = Bytes(_count * sizeof(U));
+				
+				if (_count != 0U) {
+					std::memcpy(_data, bytes.data(), bytes.size());
+				}
+				
+				if constexpr (s_BigEndian && sizeof(U) > 1U) {
+					
+					for (size_t i = 0U; i < _count; ++i) {
+						_data[i] = ByteSwap(_data[i]);
+					}
+				}
+			}
+			
+			/**
+			 * @brief Replaces the contents of a vector with an array.
+			 * @param[out] _data The vector.
+			 * @param[in] _count The number of elements of the array.
+			 * @throws std::runtime_error If the array extends beyond the end of the buffer.
+			 */
+			template <typename U>
+			void Array(std::vector<U>& _data, const size_t& _count) {
+				
+				// Check the bounds before allocating, so a corrupt count cannot exhaust memory.
+				if (_count > (m_Data.size() - m_Offset) / sizeof(U)) {
+					throw std::runtime_error("Unexpected end of binary cache!");
+				}
+				
+				_data.resize(_count);
+				
+				Array(_data.data(), _count);
+			}
+			
+			template <typename U>
+			U Value() {
+				
+				U result;
+				Array(&result, 1U);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Consumes the header of a column written by BinaryWriter, and validates its kind.
+			 * @param[in] _kind The expected kind of the column.
+			 * @param[in] _width The expected width of each value of the column, in bytes.
+			 * @param[in] _rows The number of rows of the catalogue.
+			 * @return The number of rows of the column, which is either 0 or _rows.
+			 * @throws std::runtime_error If the header does not match.
+			 */
+			size_t Column(const char& _kind, const size_t& _width, const size_t& _rows) {
+				
+				const auto kind  = Value<uint32_t>();
+				const auto width = Value<uint32_t>();
+				const auto size  = Value<uint64_t>();
+				
+				if (kind != static_cast<uint32_t>(_kind) || width != _width || (size != 0U && size != _rows)) {
+					throw std::runtime_error("Binary cache does not match the layout of the ATHYG version!");
+				}
+				
+				return static_cast<size_t>(size);
+			}
+		};
+		
+	public:
+		
+		/**
+		 * @struct V1
+		 * @brief Utility for deserialising version 1 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
+		 *
+		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
+		 */
+		struct [[maybe_unused]] V1 final {
+			
+			[[maybe_unused]] std::optional<size_t>      id;
+			[[maybe_unused]] std::optional<std::string> tyc;
+			[[maybe_unused]] std::optional<size_t>      gaia;
+			[[maybe_unused]] std::optional<size_t>      hyg;
+			[[maybe_unused]] std::optional<size_t>      hip;
+			[[maybe_unused]] std::optional<size_t>      hd;
+			[[maybe_unused]] std::optional<size_t>      hr;
+			[[maybe_unused]] std::optional<std::string> gl;
+			[[maybe_unused]] std::optional<std::string> bayer;
+			[[maybe_unused]] std::optional<std::string> flam;
+			[[maybe_unused]] std::optional<std::string> con;
+			[[maybe_unused]] std::optional<std::string> proper;
+			[[maybe_unused]] std::optional<double>      ra;
+			[[maybe_unused]] std::optional<double>      dec;
+			[[maybe_unused]] std::optional<std::string> pos_src;
+			[[maybe_unused]] std::optional<double>      dist;
+			[[maybe_unused]] std::optional<double>      x0;
+			[[maybe_unused]] std::optional<double>      y0;
+			[[maybe_unused]] std::optional<double>      z0;
+			[[maybe_unused]] std::optional<std::string> dist_src;
+			[[maybe_unused]] std::optional<double>      mag;
+			[[maybe_unused]] std::optional<double>      absmag;
+			[[maybe_unused]] std::optional<std::string> mag_src;
+			
+			/**
+			 * @enum Field
+			 * @brief The fields of the version, valued by their column index.
+			 */
+			enum class Field : size_t {
+				id,
+				tyc,
+				gaia,
+				hyg,
+				hip,
+				hd,
+				hr,
+				gl,
+				bayer,
+				flam,
+				con,
+				proper,
+				ra,
+				dec,
+				pos_src,
+				dist,
+				x0,
+				y0,
+				z0,
+				dist_src,
+				mag,
+				absmag,
+				mag_src
+			};
+			
+			/** @brief The tag identifying the version in a binary cache. */
+			static constexpr uint32_t s_Version { 1U };
+			
+			template <typename U>
+			using Describe = Descriptor<V1, U>;
+			
+			/** @brief The schema of the version, describing each field, ordered by column index. */
+			static constexpr std::tuple s_Schema {
+				Describe<size_t>      { Field::id,       "id",       &V1::id       },
+				Describe<std::string> { Field::tyc,      "tyc",      &V1::tyc      },
+				Describe<size_t>      { Field::gaia,     "gaia",     &V1::gaia     },
+				Describe<size_t>      { Field::hyg,      "hyg",      &V1::hyg      },
+				Describe<size_t>      { Field::hip,      "hip",      &V1::hip      },
+				Describe<size_t>      { Field::hd,       "hd",       &V1::hd       },
+				Describe<size_t>      { Field::hr,       "hr",       &V1::hr       },
+				Describe<std::string> { Field::gl,       "gl",       &V1::gl       },
+				Describe<std::string> { Field::bayer,    "bayer",    &V1::bayer    },
+				Describe<std::string> { Field::flam,     "flam",     &V1::flam     },
+				Describe<Symbol>      { Field::con,      "con",      &V1::con      },
+				Describe<std::string> { Field::proper,   "proper",   &V1::proper   },
+				Describe<double>      { Field::ra,       "ra",       &V1::ra       },
+				Describe<double>      { Field::dec,      "dec",      &V1::dec      },
+				Describe<Symbol>      { Field::pos_src,  "pos_src",  &V1::pos_src  },
+				Describe<double>      { Field::dist,     "dist",     &V1::dist     },
+				Describe<double>      { Field::x0,       "x0",       &V1::x0       },
+				Describe<double>      { Field::y0,       "y0",       &V1::y0       },
+				Describe<double>      { Field::z0,       "z0",       &V1::z0       },
+				Describe<Symbol>      { Field::dist_src, "dist_src", &V1::dist_src },
+				Describe<double>      { Field::mag,      "mag",      &V1::mag      },
+				Describe<double>      { Field::absmag,   "absmag",   &V1::absmag   },
+				Describe<Symbol>      { Field::mag_src,  "mag_src",  &V1::mag_src  }
+			};
+			
+			[[maybe_unused]] static constexpr size_t s_ElementCount { std::tuple_size_v<decltype(s_Schema)> };
+			
+			/** @brief The type each field is parsed as, ordered by column index. Text fields are either std::string or Symbol. */
+			using Types = TypesOf<std::remove_const_t<decltype(s_Schema)>>::type;
+			
+			/** @brief The name of each field in the header of the CSV file, ordered by column index. */
+			static constexpr std::array<std::string_view, s_ElementCount> s_Names = std::apply([](const auto&... _fields) noexcept {
+				return std::array<std::string_view, sizeof...(_fields)> { _fields.name... };
+			}, s_Schema);
+			
+			template <typename T, uint64_t _Mask = ~static_cast<uint64_t>(0U)>
+			explicit V1(const std::array<T, s_ElementCount>& _values, std::integral_constant<uint64_t, _Mask> = {}) noexcept {
+				Populate<_Mask>(*this, _values, std::make_index_sequence<s_ElementCount>());
+			}
+		};
+		
+		/**
+		 * @struct V2
+		 * @brief Utility for deserialising version 2 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
+		 *
+		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
+		 */
+		struct [[maybe_unused]] V2 final {
+			
+			[[maybe_unused]] std::optional<size_t>      id;
+			[[maybe_unused]] std::optional<std::string> tyc;
+			[[maybe_unused]] std::optional<size_t>      gaia;
+			[[maybe_unused]] std::optional<size_t>      hyg;
+			[[maybe_unused]] std::optional<size_t>      hip;
+			[[maybe_unused]] std::optional<size_t>      hd;
+			[[maybe_unused]] std::optional<size_t>      hr;
+			[[maybe_unused]] std::optional<std::string> gl;
+			[[maybe_unused]] std::optional<std::string> bayer;
+			[[maybe_unused]] std::optional<std::string> flam;
+			[[maybe_unused]] std::optional<std::string> con;
+			[[maybe_unused]] std::optional<std::string> proper;
+			[[maybe_unused]] std::optional<double>      ra;
+			[[maybe_unused]] std::optional<double>      dec;
+			[[maybe_unused]] std::optional<std::string> pos_src;
+			[[maybe_unused]] std::optional<double>      dist;
+			[[maybe_unused]] std::optional<double>      x0;
+			[[maybe_unused]] std::optional<double>      y0;
+			[[maybe_unused]] std::optional<double>      z0;
+			[[maybe_unused]] std::optional<std::string> dist_src;
+			[[maybe_unused]] std::optional<double>      mag;
+			[[maybe_unused]] std::optional<double>      absmag;
+			[[maybe_unused]] std::optional<std::string> mag_src;
+			[[maybe_unused]] std::optional<double>      rv;
+			[[maybe_unused]] std::optional<std::string> rv_src;
+			[[maybe_unused]] std::optional<double>      pm_ra;
+			[[maybe_unused]] std::optional<double>      pm_dec;
+			[[maybe_unused]] std::optional<std::string> pm_src;
+			[[maybe_unused]] std::optional<double>      vx;
+			[[maybe_unused]] std::optional<double>      vy;
+			[[maybe_unused]] std::optional<double>      vz;
+			[[maybe_unused]] std::optional<std::string> spect;
+			[[maybe_unused]] std::optional<std::string> spect_src;
+			
+			/**
+			 * @enum Field
+			 * @brief The fields of the version, valued by their column index.
+			 */
+			enum class Field : size_t {
+				id,
+				tyc,
+				gaia,
+				hyg,
+				hip,
+				hd,
+				hr,
+				gl,
+				bayer,
+				flam,
+				con,
+				proper,
+				ra,
+				dec,
+				pos_src,
+				dist,
+				x0,
+				y0,
+				z0,
+				dist_src,
+				mag,
+				absmag,
+				mag_src,
+				rv,
+				rv_src,
+				pm_ra,
+				pm_dec,
+				pm_src,
+				vx,
+				vy,
+				vz,
+				spect,
+				spect_src
+			};
+			
+			/** @brief The tag identifying the version in a binary cache. */
+			static constexpr uint32_t s_Version { 2U };
+			
+			template <typename U>
+			using Describe = Descriptor<V2, U>;
+			
+			/** @brief The schema of the version, describing each field, ordered by column index. */
+			static constexpr std::tuple s_Schema {
+				Describe<size_t>      { Field::id,        "id",        &V2::id        },
+				Describe<std::string> { Field::tyc,       "tyc",       &V2::tyc       },
+				Describe<size_t>      { Field::gaia,      "gaia",      &V2::gaia      },
+				Describe<size_t>      { Field::hyg,       "hyg",       &V2::hyg       },
+				Describe<size_t>      { Field::hip,       "hip",       &V2::hip       },
+				Describe<size_t>      { Field::hd,        "hd",        &V2::hd        },
+				Describe<size_t>      { Field::hr,        "hr",        &V2::hr        },
+				Describe<std::string> { Field::gl,        "gl",        &V2::gl        },
+				Describe<std::string> { Field::bayer,     "bayer",     &V2::bayer     },
+				Describe<std::string> { Field::flam,      "flam",      &V2::flam      },
+				Describe<Symbol>      { Field::con,       "con",       &V2::con       },
+				Describe<std::string> { Field::proper,    "proper",    &V2::proper    },
+				Describe<double>      { Field::ra,        "ra",        &V2::ra        },
+				Describe<double>      { Field::dec,       "dec",       &V2::dec       },
+				Describe<Symbol>      { Field::pos_src,   "pos_src",   &V2::pos_src   },
+				Describe<double>      { Field::dist,      "dist",      &V2::dist      },
+				Describe<double>      { Field::x0,        "x0",        &V2::x0        },
+				Describe<double>      { Field::y0,        "y0",        &V2::y0        },
+				Describe<double>      { Field::z0,        "z0",        &V2::z0        },
+				Describe<Symbol>      { Field::dist_src,  "dist_src",  &V2::dist_src  },
+				Describe<double>      { Field::mag,       "mag",       &V2::mag       },
+				Describe<double>      { Field::absmag,    "absmag",    &V2::absmag    },
+				Describe<Symbol>      { Field::mag_src,   "mag_src",   &V2::mag_src   },
+				Describe<double>      { Field::rv,        "rv",        &V2::rv        },
+				Describe<Symbol>      { Field::rv_src,    "rv_src",    &V2::rv_src    },
+				Describe<double>      { Field::pm_ra,     "pm_ra",     &V2::pm_ra     },
+				Describe<double>      { Field::pm_dec,    "pm_dec",    &V2::pm_dec    },
+				Describe<Symbol>      { Field::pm_src,    "pm_src",    &V2::pm_src    },
+				Describe<double>      { Field::vx,        "vx",        &V2::vx        },
+				Describe<double>      { Field::vy,        "vy",        &V2::vy        },
+				Describe<double>      { Field::vz,        "vz",        &V2::vz        },
+				Describe<std::string> { Field::spect,     "spect",     &V2::spect     },
+				Describe<Symbol>      { Field::spect_src, "spect_src", &V2::spect_src }
+			};
+			
+			[[maybe_unused]] static constexpr size_t s_ElementCount { std::tuple_size_v<decltype(s_Schema)> };
+			
+			/** @brief The type each field is parsed as, ordered by column index. Text fields are either std::string or Symbol. */
+			using Types = TypesOf<std::remove_const_t<decltype(s_Schema)>>::type;
+			
+			/** @brief The name of each field in the header of the CSV file, ordered by column index. */
+			static constexpr std::array<std::string_view, s_ElementCount> s_Names = std::apply([](const auto&... _fields) noexcept {
+				return std::array<std::string_view, sizeof...(_fields)> { _fields.name... };
+			}, s_Schema);
+			
+			template <typename T, uint64_t _Mask = ~static_cast<uint64_t>(0U)>
+			explicit V2(const std::array<T, s_ElementCount>& _values, std::integral_constant<uint64_t, _Mask> = {}) noexcept {
+				Populate<_Mask>(*this, _values, std::make_index_sequence<s_ElementCount>());
+			}
+		};
+		
+		/**
+		 * @struct V3
+		 * @brief Utility for deserialising version 3 of the <a href="https://github.com/astronexus/ATHYG-Database/tree/main">ATHYG dataset</a>.
+		 *
+		 * @see <a href="https://github.com/astronexus/ATHYG-Database/blob/main/version-info.md">ATHYG version info.</a>
+		 */
+		struct [[maybe_unused]] V3 final {
+			
+			[[maybe_unused]] std::optional<size_t>      id;
+			[[maybe_unused]] std::optional<std::string> tyc;
+			[[maybe_unused]] std::optional<size_t>      gaia;
+			[[maybe_unused]] std::optional<size_t>      hyg;
+			[[maybe_unused]] std::optional<size_t>      hip;
+			[[maybe_unused]] std::optional<size_t>      hd;
+			[[maybe_unused]] std::optional<size_t>      hr;
+			[[maybe_unused]] std::optional<std::string> gl;
+			[[maybe_unused]] std::optional<std::string> bayer;
+			[[maybe_unused]] std::optional<std::string> flam;
+			[[maybe_unused]] std::optional<std::string> con;
+			[[maybe_unused]] std::optional<std::string> proper;
+			[[maybe_unused]] std::optional<double>      ra;
+			[[maybe_unused]] std::optional<double>      dec;
+			[[maybe_unused]] std::optional<std::string> pos_src;
+			[[maybe_unused]] std::optional<double>      dist;
+			[[maybe_unused]] std::optional<double>      x0;
+			[[maybe_unused]] std::optional<double>      y0;
+			[[maybe_unused]] std::optional<double>      z0;
+			[[maybe_unused]] std::optional<std::string> dist_src;
+			[[maybe_unused]] std::optional<double>      mag;
+			[[maybe_unused]] std::optional<double>      absmag;
+			[[maybe_unused]] std::optional<double>      ci;
+			[[maybe_unused]] std::optional<std::string> mag_src;
+			[[maybe_unused]] std::optional<double>      rv;
+			[[maybe_unused]] std::optional<std::string> rv_src;
+			[[maybe_unused]] std::optional<double>      pm_ra;
+			[[maybe_unused]] std::optional<double>      pm_dec;
+			[[maybe_unused]] std::optional<std::string> pm_src;
+			[[maybe_unused]] std::optional<double>      vx;
+			[[maybe_unused]] std::optional<double>      vy;
+			[[maybe_unused]] std::optional<double>      vz;
+			[[maybe_unused]] std::optional<std::string> spect;
+			[[maybe_unused]] std::optional<std::string> spect_src;
+			
+			/**
+			 * @enum Field
+			 * @brief The fields of the version, valued by their column index.
+			 */
+			enum class Field : size_t {
+				id,
+				tyc,
+				gaia,
+				hyg,
+				hip,
+				hd,
+				hr,
+				gl,
+				bayer,
+				flam,
+				con,
+				proper,
+				ra,
+				dec,
+				pos_src,
+				dist,
+				x0,
+				y0,
+				z0,
+				dist_src,
+				mag,
+				absmag,
+				ci,
+				mag_src,
+				rv,
+				rv_src,
+				pm_ra,
+				pm_dec,
+				pm_src,
+				vx,
+				vy,
+				vz,
+				spect,
+				spect_src
+			};
+			
+			/** @brief The tag identifying the version in a binary cache. */
+			static constexpr uint32_t s_Version { 3U };
+			
+			template <typename U>
+			using Describe = Descriptor<V3, U>;
+			
+			/** @brief The schema of the version, describing each field, ordered by column index. */
+			static constexpr std::tuple s_Schema {
+				Describe<size_t>      { Field::id,        "id",        &V3::id        },
+				Describe<std::string> { Field::tyc,       "tyc",       &V3::tyc       },
+				Describe<size_t>      { Field::gaia,      "gaia",      &V3::gaia      },
+				Describe<size_t>      { Field::hyg,       "hyg",       &V3::hyg       },
+				Describe<size_t>      { Field::hip,       "hip",       &V3::hip       },
+				Describe<size_t>      { Field::hd,        "hd",        &V3::hd        },
+				Describe<size_t>      { Field::hr,        "hr",        &V3::hr        },
+				Describe<std::string> { Field::gl,        "gl",        &V3::gl        },
+				Describe<std::string> { Field::bayer,     "bayer",     &V3::bayer     },
+				Describe<std::string> { Field::flam,      "flam",      &V3::flam      },
+				Describe<Symbol>      { Field::con,       "con",       &V3::con       },
+				Describe<std::string> { Field::proper,    "proper",    &V3::proper    },
+				Describe<double>      { Field::ra,        "ra",        &V3::ra        },
+				Describe<double>      { Field::dec,       "dec",       &V3::dec       },
+				Describe<Symbol>      { Field::pos_src,   "pos_src",   &V3::pos_src   },
+				Describe<double>      { Field::dist,      "dist",      &V3::dist      },
+				Describe<double>      { Field::x0,        "x0",        &V3::x0        },
+				Describe<double>      { Field::y0,        "y0",        &V3::y0        },
+				Describe<double>      { Field::z0,        "z0",        &V3::z0        },
+				Describe<Symbol>      { Field::dist_src,  "dist_src",  &V3::dist_src  },
+				Describe<double>      { Field::mag,       "mag",       &V3::mag       },
+				Describe<double>      { Field::absmag,    "absmag",    &V3::absmag    },
+				Describe<double>      { Field::ci,        "ci",        &V3::ci        },
+				Describe<Symbol>      { Field::mag_src,   "mag_src",   &V3::mag_src   },
+				Describe<double>      { Field::rv,        "rv",        &V3::rv        },
+				Describe<Symbol>      { Field::rv_src,    "rv_src",    &V3::rv_src    },
+				Describe<double>      { Field::pm_ra,     "pm_ra",     &V3::pm_ra     },
+				Describe<double>      { Field::pm_dec,    "pm_dec",    &V3::pm_dec    },
+				Describe<Symbol>      { Field::pm_src,    "pm_src",    &V3::pm_src    },
+				Describe<double>      { Field::vx,        "vx",        &V3::vx        },
+				Describe<double>      { Field::vy,        "vy",        &V3::vy        },
+				Describe<double>      { Field::vz,        "vz",        &V3::vz        },
+				Describe<std::string> { Field::spect,     "spect",     &V3::spect     },
+				Describe<Symbol>      { Field::spect_src, "spect_src", &V3::spect_src }
+			};
+			
+			[[maybe_unused]] static constexpr size_t s_ElementCount { std::tuple_size_v<decltype(s_Schema)> };
+			
+			/** @brief The type each field is parsed as, ordered by column index. Text fields are either std::string or Symbol. */
+			using Types = TypesOf<std::remove_const_t<decltype(s_Schema)>>::type;
+			
+			/** @brief The name of each field in the header of the CSV file, ordered by column index. */
+			static constexpr std::array<std::string_view, s_ElementCount> s_Names = std::apply([](const auto&... _fields) noexcept {
+				return std::array<std::string_view, sizeof...(_fields)> { _fields.name... };
+			}, s_Schema);
+			
+			template <typename T, uint64_t _Mask = ~static_cast<uint64_t>(0U)>
+			explicit V3(const std::array<T, s_ElementCount>& _values, std::integral_constant<uint64_t, _Mask> = {}) noexcept {
+				Populate<_Mask>(*this, _values, std::make_index_sequence<s_ElementCount>());
+			}
+		};
+		
+		/**
+		 * @struct Projection
+		 * @brief Compile-time selection of the fields of an ATHYG dataset version to parse.
+		 *
+		 * Fields that are not selected are skipped while tokenising: they are not converted, and no strings are allocated for them.
+		 * Fields beyond the last selected field are not tokenised at all, only counted.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 *
+		 * const auto stars = ATHYG::Load<ATHYG::V3, ATHYG::Projection<ATHYG::V3, F::id, F::x0, F::y0, F::z0, F::absmag, F::ci>>(paths);
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam Fs The fields to parse. If no fields are given, every field is parsed.
+		 */
+		template <typename T, typename T::Field... Fs>
+		struct Projection final {
+			
+			static_assert(T::s_ElementCount <= 64U, "Projection masks are limited to 64 fields!");
+			
+			/** @brief The ATHYG dataset version the projection applies to. */
+			using Version = T;
+			
+			/** @brief The projection mask, where bit i selects the field at column index i. */
+			static constexpr uint64_t s_Mask {
+				sizeof...(Fs) == 0U ?
+					(~static_cast<uint64_t>(0U) >> (64U - T::s_ElementCount)) :
+					(0U | ... | (static_cast<uint64_t>(1U) << static_cast<size_t>(Fs)))
+			};
+			
+			/**
+			 * @brief Returns whether a field is selected by the projection.
+			 * @param[in] _field The field.
+			 * @return True if the field is parsed, false otherwise.
+			 */
+			[[nodiscard]] static constexpr bool Contains(const typename T::Field& _field) noexcept {
+				return ((s_Mask >> static_cast<size_t>(_field)) & 1U) != 0U;
+			}
+		};
+		
+		/**
+		 * @struct Interleaved
+		 * @brief Compile-time layout of an interleaved vertex of numeric fields, for Export.
+		 *
+		 * Each vertex holds the selected fields in the order given, each converted to the same floating-point type, with no padding between them.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 *
+		 * // { float x, y, z; float absmag; float ci; }
+		 * using Vertex = ATHYG::Interleaved<ATHYG::V3, float, F::x0, F::y0, F::z0, F::absmag, F::ci>;
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam U The floating-point type of each field of the vertex.
+		 * @tparam Fs The fields of the vertex, in order. Must be numeric.
+		 */
+		template <typename T, typename U, typename T::Field... Fs>
+		struct Interleaved final {
+			
+			static_assert(std::is_floating_point_v<U>, "Vertex fields must be floating-point!");
+			
+			static_assert(sizeof...(Fs) != 0U, "Vertex must contain at least one field!");
+			
+			static_assert((std::is_arithmetic_v<std::tuple_element_t<static_cast<size_t>(Fs), typename T::Types>> && ...),
+			        "Only numeric fields can be exported!");
+			
+			/** @brief The ATHYG dataset version the layout applies to. */
+			using Version = T;
+			
+			/** @brief The type of each field of the vertex. */
+			using Type = U;
+			
+			/** @brief The number of fields of the vertex. */
+			static constexpr size_t s_Count { sizeof...(Fs) };
+			
+			/** @brief The column index of each field of the vertex, in order. */
+			static constexpr std::array<size_t, s_Count> s_Fields { static_cast<size_t>(Fs)... };
+			
+			/** @brief The mask of the fields of the vertex, where bit i selects the field at column index i. */
+			static constexpr uint64_t s_Mask { (0U | ... | (static_cast<uint64_t>(1U) << static_cast<size_t>(Fs))) };
+			
+			/** @brief The size of a vertex in bytes, which is the stride of a tightly-packed buffer. */
+			static constexpr size_t s_Stride { s_Count * sizeof(U) };
+		};
+		
+		/**
+		 * @brief The comparisons a Filter can apply to a field.
+		 */
+		enum class Comparison : unsigned char {
+			Less,         /**< @brief The field is present and less than the operand.                */
+			LessEqual,    /**< @brief The field is present and less than or equal to the operand.    */
+			Greater,      /**< @brief The field is present and greater than the operand.             */
+			GreaterEqual, /**< @brief The field is present and greater than or equal to the operand. */
+			Equal,        /**< @brief The field is present and equal to the operand.                 */
+			NotEqual,     /**< @brief The field is present and not equal to the operand.             */
+			HasValue,     /**< @brief The field is present. The operand is ignored.                  */
+			NoValue,      /**< @brief The field is not present. The operand is ignored.              */
+		};
+		
+		/**
+		 * @class Filter
+		 * @brief A conjunction of conditions on the fields of a star, evaluated while parsing.
+		 *
+		 * Each condition is evaluated on the tokenised fields of a row as soon as the row is tokenised, converting only the fields it refers to.
+		 * Rows that fail any condition are discarded before the rest of the row is converted, and before any string is allocated.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 *
+		 * // Naked-eye stars with a Hipparcos identifier.
+		 * ATHYG::Filter<ATHYG::V3> filter;
+		 * filter.Where(F::mag, ATHYG::Comparison::Less, 6.5)
+		 *       .Where(F::hip, ATHYG::Comparison::HasValue);
+		 *
+		 * const auto stars = ATHYG::Load<ATHYG::V3>(paths, ATHYG::Options(), filter);
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @note Integer fields are compared exactly with whole operands, and other numeric fields as doubles. Text fields only support Comparison::HasValue and Comparison::NoValue.
+		 */
+		template <typename T>
+		class Filter final {
+			
+			friend ATHYG;
+			
+			/** @brief How the values of a field are compared. */
+			enum class Kind : unsigned char {
+				Floating, /**< @brief Parsed and compared as a double. */
+				Unsigned, /**< @brief Parsed as an unsigned 64-bit integer, and compared exactly. */
+				Signed,   /**< @brief Parsed as a signed 64-bit integer, and compared exactly. */
+				Text      /**< @brief Only tested for presence. */
+			};
+			
+			/** @brief An integer of either sign, as a sign and a magnitude, so that every signed and unsigned 64-bit integer can be compared exactly. */
+			struct Integer final {
+				bool     negative;
+				uint64_t magnitude;
+			};
+			
+			struct Condition final {
+				
+				size_t     index;
+				Comparison comparison;
+				Kind       kind;
+				double     operand;
+				
+				/** @brief The operand as an integer, which is compared with the field instead of operand if exact is set. */
+				Integer integer;
+				bool    exact;
+			};
+			
+			template <typename U>
+			static constexpr Kind KindOf() noexcept {
+				
+				if constexpr (std::is_floating_point_v<U>) {
+					return Kind::Floating;
+				}
+				else if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U>) {
+					return Kind::Unsigned;
+				}
+				else if constexpr (std::is_integral_v<U>) {
+					return Kind::Signed;
+				}
+				else {
+					return Kind::Text;
+				}
+			}
+			
+			template <size_t... Is>
+			static constexpr std::array<Kind, T::s_ElementCount> Kinds(std::index_sequence<Is...>) noexcept {
+				return { KindOf<std::tuple_element_t<Is, typename T::Types>>()... };
+			}
+			
+			/** @brief How the field at each column index is compared. */
+			static constexpr auto s_Kinds { Kinds(std::make_index_sequence<T::s_ElementCount>()) };
+			
+			std::vector<Condition> m_Conditions;
+			
+			size_t m_Limit;
+			
+			uint64_t m_Mask;
+			
+			template <typename U>
+			static constexpr Integer ToInteger(const U& _value) noexcept {
+				
+				if constexpr (std::is_signed_v<U>) {
+					
+					// Negate in unsigned arithmetic, so that the minimum value does not overflow.
+					return _value < 0 ?
+						Integer { true,  static_cast<uint64_t>(0U) - static_cast<uint64_t>(_value) } :
+						Integer { false, static_cast<uint64_t>(_value) };
+				}
+				else {
+					return { false, static_cast<uint64_t>(_value) };
+				}
+			}
+			
+			/** @brief Returns a negative number, zero, or a positive number if _a is less than, equal to, or greater than _b. */
+			static constexpr int Compare(const Integer& _a, const Integer& _b) noexcept {
+				
+				if (_a.negative != _b.negative) {
+					return _a.negative ? -1 : 1;
+				}
+				
+				if (_a.magnitude == _b.magnitude) {
+					return 0;
+				}
+				
+				return (_a.magnitude < _b.magnitude) != _a.negative ? -1 : 1;
+			}
+			
+			/**
+			 * @brief Parses an integer field.
+			 * @param[in] _field The field.
+			 * @param[in] _kind The kind of the field, which is Kind::Unsigned or Kind::Signed.
+			 * @return The value of the field, or none if it is not present or not an integer.
+			 */
+			[[nodiscard]] static std::optional<Integer> ParseInteger(const std::string_view& _field, const Kind& _kind) noexcept {
+				
+				if (_kind == Kind::Unsigned) {
+					
+					const auto value = TryParse<uint64_t>(_field);
+					
+					return value.has_value() ? std::optional<Integer>(ToInteger(*value)) : std::nullopt;
+				}
+				
+				const auto value = TryParse<int64_t>(_field);
+				
+				return value.has_value() ? std::optional<Integer>(ToInteger(*value)) : std::nullopt;
+			}
+			
+			/**
+			 * @brief Evaluates every condition on the tokenised fields of a row.
+			 * @param[in] _fields The fields of the row. Fields below Limit() must be stored.
+			 * @return True if the row satisfies every condition, false otherwise.
+			 */
+			[[nodiscard]] bool operator()(const std::array<std::string_view, T::s_ElementCount>& _fields) const noexcept {
+				
+				for (const auto& condition : m_Conditions) {
+					
+					const auto& field = _fields[condition.index];
+					
+					bool result;
+					
+					if (condition.exact) {
+						
+						const auto value = ParseInteger(field, condition.kind);
+						
+						const auto order = value.has_value() ? Compare(*value, condition.integer) : 0;
+						
+						switch (condition.comparison) {
+							case Comparison::Less:         { result = value.has_value() && order <  0; break; }
+							case Comparison::LessEqual:    { result = value.has_value() && order <= 0; break; }
+							case Comparison::Greater:      { result = value.has_value() && order >  0; break; }
+							case Comparison::GreaterEqual: { result = value.has_value() && order >= 0; break; }
+							case Comparison::Equal:        { result = value.has_value() && order == 0; break; }
+							case Comparison::NotEqual:     { result = value.has_value() && order != 0; break; }
+							case Comparison::HasValue:     { result =  value.has_value(); break; }
+							default:                       { result = !value.has_value(); break; }
+						}
+					}
+					else {
+						
+						std::optional<double> value;
+						
+						if (condition.kind == Kind::Floating) {
+							value = TryParse<double>(field);
+						}
+						else if (condition.kind == Kind::Text) {
+							
+							if (!field.empty()) {
+								value = 0.0;
+							}
+						}
+						else if (const auto integer = ParseInteger(field, condition.kind)) {
+							
+							const auto magnitude = static_cast<double>(integer->magnitude);
+							
+							value = integer->negative ? -magnitude : magnitude;
+						}
+						
+						switch (condition.comparison) {
+							case Comparison::Less:         { result = value.has_value() && *value <  condition.operand; break; }
+							case Comparison::LessEqual:    { result = value.has_value() && *value <= condition.operand; break; }
+							case Comparison::Greater:      { result = value.has_value() && *value >  condition.operand; break; }
+							case Comparison::GreaterEqual: { result = value.has_value() && *value >= condition.operand; break; }
+							case Comparison::Equal:        { result = value.has_value() && *value == condition.operand; break; }
+							case Comparison::NotEqual:     { result = value.has_value() && *value != condition.operand; break; }
+							case Comparison::HasValue:     { result =  value.has_value(); break; }
+							default:                       { result = !value.has_value(); break; }
+						}
+					}
+					
+					if (!result) {
+						return false;
+					}
+				}
+				
+				return true;
+			}
+			
+			/**
+			 * @brief Adds a condition to the filter.
+			 * @param[in] _condition The condition, whose kind is set from the field it tests.
+			 * @throw std::runtime_error If the comparison is not supported by the type of the field.
+			 */
+			void Add(Condition _condition) {
+				
+				const auto index = _condition.index;
+				
+				if (s_Kinds[index] == Kind::Text && _condition.comparison != Comparison::HasValue && _condition.comparison != Comparison::NoValue) {
+					throw std::runtime_error("Text fields can only be tested for presence!");
+				}
+				
+				_condition.kind  = s_Kinds[index];
+				_condition.exact = _condition.exact && (_condition.kind == Kind::Unsigned || _condition.kind == Kind::Signed);
+				
+				m_Conditions.push_back(_condition);
+				m_Limit = std::max(m_Limit, index + 1U);
+				m_Mask |= static_cast<uint64_t>(1U) << index;
+			}
+			
+			/**
+			 * @brief Returns the number of leading fields that must be tokenised to evaluate the filter.
+			 * @return One more than the highest column index referred to by a condition, or 0 if there are no conditions.
+			 */
+			[[nodiscard]] size_t Limit() const noexcept {
+				return m_Limit;
+			}
+			
+			/**
+			 * @brief Returns a mask of the fields referred to by a condition, where bit i selects the field at column index i.
+			 * @return The mask of the fields tested by the filter.
+			 */
+			[[nodiscard]] uint64_t Mask() const noexcept {
+				return m_Mask;
+			}
+			
+		public:
+			
+			Filter() noexcept :
+				m_Conditions(),
+				m_Limit(0U),
+				m_Mask(0U) {}
+			
+			/**
+			 * @brief Adds a condition to the filter.
+			 *
+			 * An integer field is compared exactly with an operand which is a whole number, and otherwise as a double.
+			 *
+			 * @param[in] _field The field to test.
+			 * @param[in] _comparison The comparison to apply to the field.
+			 * @param[in] _operand (optional) The value to compare the field with. Ignored by Comparison::HasValue and Comparison::NoValue.
+			 * @return A reference to the filter.
+			 * @throw std::runtime_error If the comparison is not supported by the type of the field.
+			 */
+			Filter& Where(const typename T::Field& _field, const Comparison& _comparison, const double& _operand = 0.0) {
+				
+				// Whole numbers within the range of a 64-bit integer are converted exactly.
+				const auto whole = std::trunc(_operand) == _operand && std::abs(_operand) < 0x1.0p64;
+				
+				Add({
+					static_cast<size_t>(_field),
+					_comparison,
+					Kind::Floating,
+					_operand,
+					whole ? Integer { _operand < 0.0, static_cast<uint64_t>(std::abs(_operand)) } : Integer { false, 0U },
+					whole
+				});
+				
+				return *this;
+			}
+			
+			/**
+			 * @brief Adds a condition to the filter, with an integer operand.
+			 *
+			 * Integer fields, such as identifiers, are compared exactly with the operand, even beyond the 53 bits of precision of a double.
+			 *
+			 * @code
+			 * filter.Where(F::gaia, ATHYG::Comparison::Equal, 4295806720123456789ULL);
+			 * @endcode
+			 *
+			 * @tparam U The integer type of the operand.
+			 * @param[in] _field The field to test.
+			 * @param[in] _comparison The comparison to apply to the field.
+			 * @param[in] _operand The value to compare the field with. Ignored by Comparison::HasValue and Comparison::NoValue.
+			 * @return A reference to the filter.
+			 * @throw std::runtime_error If the comparison is not supported by the type of the field.
+			 */
+			template <typename U, std::enable_if_t<std::is_integral_v<U> && !std::is_same_v<U, bool>, int> = 0>
+			Filter& Where(const typename T::Field& _field, const Comparison& _comparison, const U& _operand) {
+				
+				Add({
+					static_cast<size_t>(_field),
+					_comparison,
+					Kind::Floating,
+					static_cast<double>(_operand),
+					ToInteger(_operand),
+					true
+				});
+				
+				return *this;
+			}
+			
+			/**
+			 * @brief Returns whether the filter has no conditions, and therefore accepts every star.
+			 * @return True if there are no conditions, false otherwise.
+			 */
+			[[nodiscard]] bool Empty() const noexcept {
+				return m_Conditions.empty();
+			}
+		};
+		
+		/**
+		 * @brief Load and parse ATHYG dataset files.
+		 *
+		 * This function loads and parses ATHYG CSV files.
+		 * The template argument must be one of the ATHYG dataset versions:
+		 * V1, V2, or V3.
+		 *
+		 * Files are parsed in parallel using the number of threads given by the options.
+		 * Large files are additionally split into newline-aligned chunks, each parsed by a separate worker.
+		 * Regardless of the number of threads, rows are returned in file order, then row order.
+		 *
+		 * If a projection is given, only the selected fields are parsed, and every other field of the result is empty.
+		 *
+		 * Columns are matched to fields by the header of each file, so files with reordered or additional columns are supported.
+		 * Fields without a column are empty. Files whose header begins with the known layout of the version are parsed without any remapping.
+		 *
+		 * Malformed rows, which have fewer fields than the header, are handled according to the error policy.
+		 * By default the load is abandoned, but they may instead be discarded (and counted or recorded in the diagnostics of the options).
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @return A vector containing the deserialized data of type T.
+		 * @throw std::runtime_error If the number of elements in a CSV line
+		 * is not consistent with the ATHYG version, under the Throw error policy.
+		 * @throw std::runtime_error If the header of a file is missing a column selected by the projection.
+		 * @throw std::runtime_error If the specified path is not valid.
+		 * @throw std::runtime_error If a file cannot be memory-mapped.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 *
+		 * @see Options
+		 * @see Projection
+		 * @see Errors
+		 */
+		template <typename T, typename P = Projection<T>, Errors E = Errors::Throw>
+		static std::vector<T> Load(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options) {
+			return Read<T, P, std::vector<T>, E>(_athyg_paths, _options);
+		}
+		
+		/**
+		 * @brief Load and parse the stars of ATHYG dataset files which satisfy a filter.
+		 *
+		 * Behaves identically to Load(const std::vector<std::filesystem::path>&, const Options&),
+		 * except that rows which do not satisfy the filter are discarded before they are converted.
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[in] _filter The filter each star must satisfy to be loaded.
+		 * @return A vector containing the deserialized data of type T.
+		 * @throw std::runtime_error If the number of elements in a CSV line
+		 * is not consistent with the ATHYG version.
+		 * @throw std::runtime_error If the specified path is not valid.
+		 * @throw std::runtime_error If a file cannot be memory-mapped.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 *
+		 * @see Filter
+		 */
+		template <typename T, typename P = Projection<T>, Errors E = Errors::Throw>
+		static std::vector<T> Load(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, const Filter<T>& _filter) {
+			
+			return _filter.Empty() ?
+				Read<T, P, std::vector<T>, E>(_athyg_paths, _options) :
+				Read<T, P, std::vector<T>, E>(_athyg_paths, _options, _filter);
+		}
+		
+		/**
+		 * @brief Load and parse ATHYG dataset files using the given read strategy.
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _source The strategy used to read each file.
+		 * @return A vector containing the deserialized data of type T.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 *
+		 * @see Load(const std::vector<std::filesystem::path>&, const Options&)
+		 */
+		template <typename T, typename P = Projection<T>>
+		static std::vector<T> Load(const std::vector<std::filesystem::path>& _athyg_paths, const Source& _source) {
+			
+			Options options;
+			options.source = _source;
+			
+			return Load<T, P>(_athyg_paths, options);
+		}
+		
+		/**
+		 * @brief Load and parse ATHYG dataset files using the default options.
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @return A vector containing the deserialized data of type T.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 *
+		 * @see Load(const std::vector<std::filesystem::path>&, const Options&)
+		 */
+		template <typename T, typename P = Projection<T>>
+		static std::vector<T> Load(const std::vector<std::filesystem::path>& _athyg_paths) {
+			return Load<T, P>(_athyg_paths, Options());
+		}
+		
+		/**
+		 * @brief Parse ATHYG dataset files, invoking a visitor with each star instead of storing them.
+		 *
+		 * Files are read in blocks of roughly (chunk_size * threads) bytes, which are split into chunks and parsed in parallel as in Load.
+		 * The stars of each block are then passed to the visitor in file order, then row order, and discarded,
+		 * so the memory used is bounded by the size of a block rather than the size of the dataset.
+		 *
+		 * The visitor may return a bool, in which case returning false stops parsing after the current block: no further stars are visited,
+		 * but the rest of the block has already been parsed. Any other return value is ignored.
+		 *
+		 * @code
+		 * // Count the stars visible to the naked eye.
+		 * size_t count = 0U;
+		 *
+		 * ATHYG::Stream<ATHYG::V3>({ "athyg_v3-1.csv", "athyg_v3-2.csv" }, ATHYG::Options(), [&count](const ATHYG::V3& _star) {
+		 *     count += static_cast<size_t>(_star.mag.value_or(99.0) < 6.5);
+		 * });
+		 * @endcode
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[in] _visitor The function to invoke with each star. Must be invocable with a T&&.
+		 * @return False if the visitor stopped parsing, true otherwise.
+		 * @throw std::runtime_error If the number of elements in a CSV line
+		 * is not consistent with the ATHYG version.
+		 * @throw std::runtime_error If the specified path is not valid.
+		 * @throw std::runtime_error If a file cannot be memory-mapped.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 * @tparam F The type of the visitor.
+		 *
+		 * @note Stars are only passed to the visitor from the calling thread.
+		 *
+		 * @see Load(const std::vector<std::filesystem::path>&, const Options&)
+		 */
+		template <typename T, typename P = Projection<T>, Errors E = Errors::Throw, typename F>
+		static bool Stream(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, F&& _visitor) {
+			return Stream<T, P, E>(_athyg_paths, _options, Filter<T>(), std::forward<F>(_visitor));
+		}
+		
+		/**
+		 * @brief Parse ATHYG dataset files, invoking a visitor with each star which satisfies a filter.
+		 *
+		 * Behaves identically to Stream(const std::vector<std::filesystem::path>&, const Options&, F&&),
+		 * except that rows which do not satisfy the filter are discarded before they are converted.
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[in] _filter The filter each star must satisfy to be visited.
+		 * @param[in] _visitor The function to invoke with each star. Must be invocable with a T&&.
+		 * @return False if the visitor stopped parsing, true otherwise.
+		 * @throw std::runtime_error If the number of elements in a CSV line
+		 * is not consistent with the ATHYG version.
+		 * @throw std::runtime_error If the specified path is not valid.
+		 * @throw std::runtime_error If a file cannot be memory-mapped.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 * @tparam F The type of the visitor.
+		 *
+		 * @see Filter
+		 */
+		template <typename T, typename P = Projection<T>, Errors E = Errors::Throw, typename F>
+		static bool Stream(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, const Filter<T>& _filter, F&& _visitor) {
+			
+			static_assert(IsVersion<T>::value, "Template argument must be an ATHYG version!");
+			
+			static_assert(std::is_same_v<typename P::Version, T>, "Projection must select fields of the same ATHYG version!");
+			
+			for (const auto& path : _athyg_paths) {
+				
+				if (!exists(path)) {
+					throw std::runtime_error("Path is not valid.");
+				}
+			}
+			
+			const auto threads = _options.threads == 0U ?
+				std::max(std::thread::hardware_concurrency(), 1U) :
+				_options.threads;
+			
+			const auto chunk_size = std::max(_options.chunk_size, static_cast<size_t>(1U));
+			
+			// Parsed stars of the current block, one vector per chunk. Capacity is reused between blocks.
+			std::vector<std::vector<T>> parsed;
+			
+			// Layout of the current file.
+			Layout<T> layout;
+			
+			Locator<E> locator(_options.diagnostics);
+			
+			const auto header = [&layout, &locator, &_filter](const std::string_view& _header) {
+				locator.Header(_header);
+				layout = Map<T>(_header, P::s_Mask | _filter.Mask());
+			};
+			
+			auto* const statistics = Instrument(_options);
+			
+			// Statistics of each chunk of the current block, added to the total once the block is parsed.
+			std::vector<Statistics> parts;
+			
+			// Time spent processing blocks (including visiting their stars), which is not counted as reading.
+			std::chrono::nanoseconds busy { 0 };
+			
+			const auto visit = [&](const std::string_view& _block) {
+				
+				const Timer processing(statistics != nullptr ? &busy : nullptr);
+				
+				const auto chunks = Chunk(_block, chunk_size);
+				
+				if (parsed.size() < chunks.size()) {
+					parsed.resize(chunks.size());
+				}
+				
+				if (statistics != nullptr) {
+					statistics->bytes += _block.size();
+					parts.assign(chunks.size(), Statistics());
+				}
+				
+				locator.Prepare(chunks.size());
+				
+				ParallelFor(chunks.size(), threads, [&](const size_t& _i) {
+					
+					parsed[_i].clear();
+					
+					auto* const part = statistics != nullptr ? &parts[_i] : nullptr;
+					
+					if (_filter.Empty()) {
+						Parse<T, P, E>(chunks[_i], parsed[_i], layout, Unfiltered(), part, locator.Part(_i));
+					}
+					else {
+						Parse<T, P, E>(chunks[_i], parsed[_i], layout, _filter, part, locator.Part(_i));
+					}
+				});
+				
+				locator.Commit(_block, chunks.data());
+				
+				for (const auto& part : parts) {
+					*statistics += part;
+				}
+				
+				parts.clear();
+				
+				for (size_t i = 0U; i < chunks.size(); ++i) {
+					
+					for (auto& star : parsed[i]) {
+						
+						if constexpr (std::is_same_v<std::invoke_result_t<F&, T&&>, bool>) {
+							
+							if (!_visitor(std::move(star))) {
+								return false;
+							}
+						}
+						else {
+							_visitor(std::move(star));
+						}
+					}
+					
+					parsed[i].clear();
+				}
+				
+				return true;
+			};
+			
+			for (const auto& path : _athyg_paths) {
+				
+				const auto start = s_Statistics && statistics != nullptr ?
+					std::chrono::steady_clock::now() :
+					std::chrono::steady_clock::time_point();
+				
+				busy = std::chrono::nanoseconds(0);
+				
+				locator.Open(path);
+				
+				const auto more = ReadBlocks(path, _options.source, chunk_size * threads, header, visit);
+				
+				if constexpr (s_Statistics) {
+					
+					if (statistics != nullptr) {
+						statistics->read += (std::chrono::steady_clock::now() - start) - busy;
+						++statistics->files;
+					}
+				}
+				
+				if (!more) {
+					return false;
+				}
+			}
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Parse ATHYG dataset files using the default options, invoking a visitor with each star instead of storing them.
+		 *
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _visitor The function to invoke with each star. Must be invocable with a T&&.
+		 * @return False if the visitor stopped parsing, true otherwise.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+		 * @tparam F The type of the visitor.
+		 *
+		 * @see Stream(const std::vector<std::filesystem::path>&, const Options&, F&&)
+		 */
+		template <typename T, typename P = Projection<T>, typename F>
+		static bool Stream(const std::vector<std::filesystem::path>& _athyg_paths, F&& _visitor) {
+			return Stream<T, P>(_athyg_paths, Options(), std::forward<F>(_visitor));
+		}
+		
+		/**
+		 * @brief Parse ATHYG dataset files directly into a buffer of interleaved vertices, without constructing any star.
+		 *
+		 * Each row is tokenised, and only the fields of the layout are converted and written to the buffer, in file order, then row order.
+		 * When parsing with one thread, vertices are written directly to the buffer as each row is parsed.
+		 * Otherwise, each chunk is packed in parallel, then copied to the buffer in order.
+		 *
+		 * The buffer may be a persistently mapped GPU staging buffer. Vertices are written whole and in order, and the bytes between vertices are not written.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 * using Vertex = ATHYG::Interleaved<ATHYG::V3, float, F::x0, F::y0, F::z0, F::absmag, F::ci>;
+		 *
+		 * std::vector<float> buffer(stars * 5U);
+		 *
+		 * const auto count = ATHYG::Export<Vertex>(paths, ATHYG::Options(), buffer.data(), buffer.size() * sizeof(float), ATHYG::Missing::Skip);
+		 * @endcode
+		 *
+		 * @tparam I The Interleaved layout of each vertex.
+		 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[in] _filter The filter each row must satisfy to be exported.
+		 * @param[out] _buffer The buffer to write the vertices to.
+		 * @param[in] _size The size of the buffer in bytes.
+		 * @param[in] _missing (optional) The policy for fields without a value. Defaults to writing NaN.
+		 * @param[in] _stride (optional) The distance between the start of consecutive vertices in bytes. Defaults to the size of a vertex.
+		 * @return The number of vertices written.
+		 * @throw std::runtime_error If the buffer is too small for every exported star.
+		 * @throw std::runtime_error If the stride is less than the size of a vertex.
+		 * @throw std::runtime_error If the specified path is not valid.
+		 */
+		template <typename I, Errors E = Errors::Throw>
+		static size_t Export(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, const Filter<typename I::Version>& _filter, void* _buffer, const size_t& _size, const Missing& _missing = Missing::NaN, const size_t& _stride = I::s_Stride) {
+			
+			using T = typename I::Version;
+			
+			for (const auto& path : _athyg_paths) {
+				
+				if (!exists(path)) {
+					throw std::runtime_error("Path is not valid.");
+				}
+			}
+			
+			const auto threads = _options.threads == 0U ?
+				std::max(std::thread::hardware_concurrency(), 1U) :
+				_options.threads;
+			
+			const auto chunk_size = std::max(_options.chunk_size, static_cast<size_t>(1U));
+			
+			Packer<I> result(_buffer, _size, _stride, _missing);
+			
+			// Packed vertices of the current block, one packer per chunk. Capacity is reused between blocks.
+			std::vector<Packer<I>> parsed;
+			
+			// Layout of the current file.
+			Layout<T> layout;
+			
+			Locator<E> locator(_options.diagnostics);
+			
+			const auto header = [&layout, &locator, &_filter](const std::string_view& _header) {
+				locator.Header(_header);
+				layout = Map<T>(_header, I::s_Mask | _filter.Mask());
+			};
+			
+			const auto pack = [&](const std::string_view& _rows, Packer<I>& _packer, Statistics* const _statistics, Errata* const _errata) {
+				
+				if (_filter.Empty()) {
+					Parse<T, I, E>(_rows, _packer, layout, Unfiltered(), _statistics, _errata);
+				}
+				else {
+					Parse<T, I, E>(_rows, _packer, layout, _filter, _statistics, _errata);
+				}
+			};
+			
+			auto* const statistics = Instrument(_options);
+			
+			// Statistics of each chunk of the current block, added to the total once the block is packed.
+			std::vector<Statistics> parts;
+			
+			for (const auto& path : _athyg_paths) {
+				
+				// The time spent reading is the time spent in ReadBlocks, less the time spent processing each block.
+				const auto start = s_Statistics && statistics != nullptr ?
+					std::chrono::steady_clock::now() :
+					std::chrono::steady_clock::time_point();
+				
+				std::chrono::nanoseconds busy { 0 };
+				
+				locator.Open(path);
+				
+				ReadBlocks(path, _options.source, chunk_size * threads, header, [&](const std::string_view& _block) {
+					
+					const Timer processing(statistics != nullptr ? &busy : nullptr);
+					
+					if (statistics != nullptr) {
+						statistics->bytes += _block.size();
+					}
+					
+					if (threads == 1U) {
+						
+						locator.Prepare(1U);
+						
+						pack(_block, result, statistics, locator.Part(0U));
+						
+						locator.Commit(_block, &_block);
+					}
+					else {
+						
+						const auto chunks = Chunk(_block, chunk_size);
+						
+						if (parsed.size() < chunks.size()) {
+							parsed.resize(chunks.size(), Packer<I>(_missing));
+						}
+						
+						if (statistics != nullptr) {
+							parts.assign(chunks.size(), Statistics());
+						}
+						
+						locator.Prepare(chunks.size());
+						
+						ParallelFor(chunks.size(), threads, [&](const size_t& _i) {
+							parsed[_i].Clear();
+							pack(chunks[_i], parsed[_i], statistics != nullptr ? &parts[_i] : nullptr, locator.Part(_i));
+						});
+						
+						locator.Commit(_block, chunks.data());
+						
+						for (const auto& part : parts) {
+							*statistics += part;
+						}
+						
+						const Timer merging(statistics != nullptr ? &statistics->construct : nullptr);
+						
+						for (size_t i = 0U; i < chunks.size(); ++i) {
+							result.Append(parsed[i]);
+						}
+					}
+					
+					return true;
+				});
+				
+				if constexpr (s_Statistics) {
+					
+					if (statistics != nullptr) {
+						statistics->read += (std::chrono::steady_clock::now() - start) - busy;
+						++statistics->files;
+					}
+				}
+			}
+			
+			return result.Size();
+		}
+		
+		/**
+		 * @brief Parse ATHYG dataset files directly into a buffer of interleaved vertices, without constructing any star.
+		 *
+		 * @tparam I The Interleaved layout of each vertex.
+		 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+		 * @param[in] _options The options used to read and parse the files.
+		 * @param[out] _buffer The buffer to write the vertices to.
+		 * @param[in] _size The size of the buffer in bytes.
+		 * @param[in] _missing (optional) The policy for fields without a value. Defaults to writing NaN.
+		 * @param[in] _stride (optional) The distance between the start of consecutive vertices in bytes. Defaults to the size of a vertex.
+		 * @return The number of vertices written.
+		 *
+		 * @see Export(const std::vector<std::filesystem::path>&, const Options&, const Filter<typename I::Version>&, void*, const size_t&, const Missing&, const size_t&)
+		 */
+		template <typename I, Errors E = Errors::Throw>
+		static size_t Export(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, void* _buffer, const size_t& _size, const Missing& _missing = Missing::NaN, const size_t& _stride = I::s_Stride) {
+			return Export<I, E>(_athyg_paths, _options, Filter<typename I::Version>(), _buffer, _size, _missing, _stride);
+		}
+		
+		/**
+		 * @class Column
+		 * @brief A contiguous array of values of a single field, with a separate validity bitmap.
+		 *
+		 * Values that are not present in the dataset are stored as a default-constructed U, and are marked as invalid in the bitmap.
+		 * Bit (i % 64) of word (i / 64) of the bitmap records whether the value of row i is present.
+		 *
+		 * @tparam U The type of the values. Must be an arithmetic type.
+		 *
+		 * @see TextColumn
+		 * @see SymbolColumn
+		 */
+		template <typename U>
+		class Column final {
+			
+			static_assert(std::is_arithmetic_v<U>, "Template argument must be an arithmetic type!");
+			
+			friend ATHYG;
+			
+			std::vector<U>        m_Values;
+			std::vector<uint64_t> m_Validity;
+			
+			void Reserve(const size_t& _capacity) {
+				Grow(m_Values, _capacity);
+				Grow(m_Validity, (_capacity + 63U) / 64U);
+			}
+			
+			void Place(const size_t& _rows) const noexcept {
+				Spread(m_Values,   _rows);
+				Spread(m_Validity, (_rows + 63U) / 64U);
+			}
+			
+			void Push(const std::string_view& _field) {
+				
+				const auto i = m_Values.size();
+				
+				if (i % 64U == 0U) {
+					m_Validity.emplace_back(0U);
+				}
+				
+				const auto value = TryParse<U>(_field);
+				
+				m_Values.emplace_back(value.value_or(U{}));
+				m_Validity.back() |= static_cast<uint64_t>(value.has_value()) << (i % 64U);
+			}
+			
+			void Append(Column&& _other) {
+				
+				const auto shift = m_Values.size() % 64U;
+				
+				m_Values.insert(m_Values.end(), _other.m_Values.begin(), _other.m_Values.end());
+				
+				if (shift == 0U) {
+					m_Validity.insert(m_Validity.end(), _other.m_Validity.begin(), _other.m_Validity.end());
+				}
+				else {
+					
+					// Splice the other bitmap in at a bit offset, then discard the trailing word if it is unused.
+					for (const auto& word : _other.m_Validity) {
+						m_Validity.back() |= word << shift;
+						m_Validity.emplace_back(word >> (64U - shift));
+					}
+					
+					m_Validity.resize((m_Values.size() + 63U) / 64U);
+				}
+			}
+			
+			void Copy(const Column& _other, const size_t& _begin, const size_t& _count) {
+				
+				Reserve(m_Values.size() + _count);
+				
+				for (size_t i = _begin; i < _begin + _count; ++i) {
+					
+					const auto j = m_Values.size();
+					
+					if (j % 64U == 0U) {
+						m_Validity.emplace_back(0U);
+					}
+					
+					m_Values.emplace_back(_other.m_Values[i]);
+					m_Validity.back() |= static_cast<uint64_t>(_other.HasValue(i)) << (j % 64U);
+				}
+			}
+			
+			void Write(BinaryWriter& _writer) const {
+				
+				_writer.Column(std::is_floating_point_v<U> ? 'f' : 'i', sizeof(U), m_Values.size());
+				
+				_writer.Align();
+				_writer.Array(m_Values.data(), m_Values.size());
+				_writer.Align();
+				_writer.Array(m_Validity.data(), m_Validity.size());
+			}
+			
+			void Read(BinaryReader& _reader, const size_t& _rows) {
+				
+				const auto size = _reader.Column(std::is_floating_point_v<U> ? 'f' : 'i', sizeof(U), _rows);
+				
+				_reader.Align();
+				_reader.Array(m_Values, size);
+				_reader.Align();
+				_reader.Array(m_Validity, (size + 63U) / 64U);
+			}
+			
+		public:
+			
+			/** @brief The type of the values. */
+			using value_type = U;
+			
+			/**
+			 * @brief Returns the number of rows in the column.
+			 * @return The number of rows.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Values.size();
+			}
+			
+			/**
+			 * @brief Returns whether the value of a row is present.
+			 * @param[in] _index The index of the row.
+			 * @return True if the value is present, false otherwise.
+			 */
+			[[nodiscard]] bool HasValue(const size_t& _index) const noexcept {
+				return ((m_Validity[_index / 64U] >> (_index % 64U)) & 1U) != 0U;
+			}
+			
+			/**
+			 * @brief Returns the stored value of a row, regardless of whether it is present.
+			 * @param[in] _index The index of the row.
+			 * @return The value of the row, or a default-constructed value if it is not present.
+			 */
+			[[nodiscard]] const U& operator[](const size_t& _index) const noexcept {
+				return m_Values[_index];
+			}
+			
+			/**
+			 * @brief Returns the value of a row if it is present.
+			 * @param[in] _index The index of the row.
+			 * @return An optional containing the value of the row, or an empty optional if it is not present.
+			 */
+			[[nodiscard]] std::optional<value_type> Get(const size_t& _index) const {
+				
+				return HasValue(_index) ?
+					std::optional<value_type>(m_Values[_index]) :
+					std::optional<value_type>(std::nullopt);
+			}
+			
+			/**
+			 * @brief Returns a pointer to the contiguous values of the column.
+			 * @return A pointer to Size() values.
+			 */
+			[[nodiscard]] const U* Data() const noexcept {
+				return m_Values.data();
+			}
+			
+			/**
+			 * @brief Returns a pointer to the validity bitmap of the column.
+			 * @return A pointer to (Size() + 63) / 64 words.
+			 */
+			[[nodiscard]] const uint64_t* Validity() const noexcept {
+				return m_Validity.data();
+			}
+			
+			/**
+			 * @brief Returns the number of rows whose value is present.
+			 * @return The number of set bits in the validity bitmap.
+			 */
+			[[nodiscard]] size_t Count() const noexcept {
+				
+				size_t result = 0U;
+				
+				for (const auto& word : m_Validity) {
+					result += std::bitset<64U>(word).count();
+				}
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @class TextColumn
+		 * @brief The strings of a single text field, packed into one contiguous arena.
+		 *
+		 * Every string of the column is stored back-to-back in a single buffer, and addressed by an array of offsets,
+		 * so a column of millions of short (and mostly empty) strings costs two allocations rather than one per string.
+		 * Strings are returned as std::string_view objects referencing the arena.
+		 *
+		 * @note Strings are considered present if they are not empty.
+		 */
+		class TextColumn final {
+			
+			friend ATHYG;
+			
+			std::string           m_Chars;
+			std::vector<uint32_t> m_Offsets;
+			
+			void Reserve(const size_t& _capacity) {
+				Grow(m_Offsets, _capacity + 1U);
+			}
+			
+			void Reserve(const size_t& _capacity, const size_t& _chars) {
+				
+				Reserve(_capacity);
+				
+				if (_chars > m_Chars.capacity()) {
+					m_Chars.reserve(_chars);
+				}
+			}
+			
+			void Place(const size_t& _rows) const noexcept {
+				
+				Spread(m_Offsets, _rows + 1U);
+				
+				if (m_Offsets.size() > _rows) {
+					
+					// Divide the arena at the first string of each node's rows, so that the strings of a row are local to the same node as its offset.
+					Spread(m_Chars.data(), m_Offsets[_rows], [this, &_rows](const size_t& _node, const size_t& _nodes) {
+						return static_cast<size_t>(m_Offsets[(_rows * _node) / _nodes]);
+					});
+				}
+				else {
+					
+					// The strings are yet to be appended, so divide the reserved arena evenly.
+					Spread(m_Chars, m_Chars.capacity());
+				}
+			}
+			
+			void Push(const std::string_view& _field) {
+				
+				if (m_Chars.size() + _field.size() > std::numeric_limits<uint32_t>::max()) {
+					throw std::length_error("Text column exceeds the maximum size of its arena!");
+				}
+				
+				if (m_Offsets.empty()) {
+					m_Offsets.emplace_back(0U);
+				}
+				
+				m_Chars.append(_field);
+				m_Offsets.emplace_back(static_cast<uint32_t>(m_Chars.size()));
+			}
+			
+			void Append(TextColumn&& _other) {
+				
+				if (_other.m_Offsets.empty()) {
+					return;
+				}
+				
+				if (m_Offsets.empty()) {
+					
+					// Adopt the other column, unless memory has been reserved (and perhaps placed) for it.
+					if (m_Offsets.capacity() == 0U) {
+						*this = std::move(_other);
+						return;
+					}
+					
+					m_Offsets.emplace_back(0U);
+				}
+				
+				if (m_Chars.size() + _other.m_Chars.size() > std::numeric_limits<uint32_t>::max()) {
+					throw std::length_error("Text column exceeds the maximum size of its arena!");
+				}
+				
+				const auto base = static_cast<uint32_t>(m_Chars.size());
+				
+				m_Chars.append(_other.m_Chars);
+				
+				m_Offsets.reserve(m_Offsets.size() + _other.m_Offsets.size() - 1U);
+				
+				for (size_t i = 1U; i < _other.m_Offsets.size(); ++i) {
+					m_Offsets.emplace_back(base + _other.m_Offsets[i]);
+				}
+			}
+			
+			void Copy(const TextColumn& _other, const size_t& _begin, const size_t& _count) {
+				
+				if (_count == 0U) {
+					return;
+				}
+				
+				const auto first = _other.m_Offsets[_begin];
+				const auto last  = _other.m_Offsets[_begin + _count];
+				
+				if (m_Chars.size() + (last - first) > std::numeric_limits<uint32_t>::max()) {
+					throw std::length_error("Text column exceeds the maximum size of its arena!");
+				}
+				
+				if (m_Offsets.empty()) {
+					m_Offsets.emplace_back(0U);
+				}
+				
+				const auto base = static_cast<uint32_t>(m_Chars.size());
+				
+				m_Chars.append(_other.m_Chars, first, last - first);
+				
+				Grow(m_Offsets, m_Offsets.size() + _count);
+				
+				for (size_t i = _begin + 1U; i <= _begin + _count; ++i) {
+					m_Offsets.emplace_back(base + (_other.m_Offsets[i] - first));
+				}
+			}
+			
+			void Write(BinaryWriter& _writer) const {
+				
+				_writer.Column('t', sizeof(char), Size());
+				
+				_writer.Align();
+				_writer.Array(m_Offsets.data(), m_Offsets.size());
+				_writer.Value(static_cast<uint64_t>(m_Chars.size()));
+				_writer.Bytes(m_Chars.data(), m_Chars.size());
+			}
+			
+			void Read(BinaryReader& _reader, const size_t& _rows) {
+				
+				const auto size = _reader.Column('t', sizeof(char), _rows);
+				
+				_reader.Align();
+				_reader.Array(m_Offsets, size == 0U ? 0U : size + 1U);
+				
+				m_Chars = _reader.Bytes(static_cast<size_t>(_reader.Value<uint64_t>()));
+				
+				// Reject offsets that would address memory outside of the arena.
+				for (size_t i = 0U; i < m_Offsets.size(); ++i) {
+					
+					if ((i == 0U ? m_Offsets[i] != 0U : m_Offsets[i] < m_Offsets[i - 1U]) || m_Offsets[i] > m_Chars.size()) {
+						throw std::runtime_error("Binary cache contains an invalid text column!");
+					}
+				}
+			}
+			
+		public:
+			
+			/** @brief The type returned when accessing a value. */
+			using value_type = std::string_view;
+			
+			/**
+			 * @brief Returns the number of rows in the column.
+			 * @return The number of rows.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Offsets.empty() ? 0U : m_Offsets.size() - 1U;
+			}
+			
+			/**
+			 * @brief Returns whether the value of a row is present.
+			 * @param[in] _index The index of the row.
+			 * @return True if the string is not empty, false otherwise.
+			 */
+			[[nodiscard]] bool HasValue(const size_t& _index) const noexcept {
+				return m_Offsets[_index + 1U] != m_Offsets[_index];
+			}
+			
+			/**
+			 * @brief Returns the string of a row.
+			 * @param[in] _index The index of the row.
+			 * @return A std::string_view referencing the arena, which is empty if the value is not present.
+			 */
+			[[nodiscard]] std::string_view operator[](const size_t& _index) const noexcept {
+				return { m_Chars.data() + m_Offsets[_index], static_cast<size_t>(m_Offsets[_index + 1U] - m_Offsets[_index]) };
+			}
+			
+			/**
+			 * @brief Returns the string of a row if it is present.
+			 * @param[in] _index The index of the row.
+			 * @return An optional containing a std::string_view referencing the arena, or an empty optional if the value is not present.
+			 */
+			[[nodiscard]] std::optional<std::string_view> Get(const size_t& _index) const noexcept {
+				
+				return HasValue(_index) ?
+					std::optional<std::string_view>((*this)[_index]) :
+					std::optional<std::string_view>(std::nullopt);
+			}
+			
+			/**
+			 * @brief Returns the number of rows whose value is present.
+			 * @return The number of non-empty strings.
+			 */
+			[[nodiscard]] size_t Count() const noexcept {
+				
+				size_t result = 0U;
+				
+				for (size_t i = 0U; i < Size(); ++i) {
+					result += static_cast<size_t>(HasValue(i));
+				}
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @class SymbolColumn
+		 * @brief The strings of a single low-cardinality text field, dictionary-encoded.
+		 *
+		 * Each distinct string is stored once in a dictionary, and every row stores a 16-bit code into the dictionary.
+		 * Suited to fields with few distinct values, such as constellation abbreviations and source tags.
+		 * Code 0 is reserved for the empty string, so a value is present if and only if its code is not 0.
+		 *
+		 * @see Symbol
+		 */
+		class SymbolColumn final {
+			
+			friend ATHYG;
+			
+			std::vector<uint16_t>    m_Codes;
+			std::vector<std::string> m_Dictionary;
+			
+			std::unordered_map<std::string, uint16_t> m_Lookup;
+			
+			uint16_t Intern(const std::string_view& _value) {
+				
+				if (_value.empty()) {
+					return 0U;
+				}
+				
+				if (m_Dictionary.empty()) {
+					m_Dictionary.emplace_back();
+				}
+				
+				// Symbols are short, so the key usually fits within the small-string buffer and does not allocate.
+				const auto [item, inserted] = m_Lookup.try_emplace(std::string(_value), static_cast<uint16_t>(m_Dictionary.size()));
+				
+				if (inserted) {
+					
+					if (m_Dictionary.size() > std::numeric_limits<uint16_t>::max()) {
+						m_Lookup.erase(item);
+						throw std::length_error("Too many distinct values for a symbol column!");
+					}
+					
+					m_Dictionary.emplace_back(_value);
+				}
+				
+				return item->second;
+			}
+			
+			void Reserve(const size_t& _capacity) {
+				Grow(m_Codes, _capacity);
+			}
+			
+			void Place(const size_t& _rows) const noexcept {
+				Spread(m_Codes, _rows);
+			}
+			
+			void Push(const std::string_view& _field) {
+				m_Codes.emplace_back(Intern(_field));
+			}
+			
+			void Append(SymbolColumn&& _other) {
+				
+				// Translate the codes of the other column into codes of this column.
+				std::vector<uint16_t> remap(_other.m_Dictionary.size(), 0U);
+				
+				for (size_t i = 1U; i < _other.m_Dictionary.size(); ++i) {
+					remap[i] = Intern(_other.m_Dictionary[i]);
+				}
+				
+				m_Codes.reserve(m_Codes.size() + _other.m_Codes.size());
+				
+				for (const auto& code : _other.m_Codes) {
+					m_Codes.emplace_back(remap.empty() ? 0U : remap[code]);
+				}
+			}
+			
+			void Copy(const SymbolColumn& _other, const size_t& _begin, const size_t& _count) {
+				
+				// Translate the codes of the other column into codes of this column, interning each symbol when it is first used.
+				std::vector<uint16_t> remap(_other.m_Dictionary.size(), 0U);
+				
+				Grow(m_Codes, m_Codes.size() + _count);
+				
+				for (size_t i = _begin; i < _begin + _count; ++i) {
+					
+					const auto code = _other.m_Codes[i];
+					
+					if (code != 0U && remap[code] == 0U) {
+						remap[code] = Intern(_other.m_Dictionary[code]);
+					}
+					
+					m_Codes.emplace_back(remap.empty() ? 0U : remap[code]);
+				}
+			}
+			
+			void Write(BinaryWriter& _writer) const {
+				
+				_writer.Column('s', sizeof(uint16_t), m_Codes.size());
+				
+				_writer.Align();
+				_writer.Array(m_Codes.data(), m_Codes.size());
+				_writer.Value(static_cast<uint64_t>(m_Dictionary.size()));
+				
+				for (const auto& symbol : m_Dictionary) {
+					_writer.Value(static_cast<uint32_t>(symbol.size()));
+					_writer.Bytes(symbol.data(), symbol.size());
+				}
+			}
+			
+			void Read(BinaryReader& _reader, const size_t& _rows) {
+				
+				const auto size = _reader.Column('s', sizeof(uint16_t), _rows);
+				
+				_reader.Align();
+				_reader.Array(m_Codes, size);
+				
+				const auto count = _reader.Value<uint64_t>();
+				
+				if (count > static_cast<uint64_t>(std::numeric_limits<uint16_t>::max()) + 1U) {
+					throw std::runtime_error("Binary cache contains an invalid symbol column!");
+				}
+				
+				m_Dictionary.clear();
+				m_Lookup.clear();
+				
+				for (uint64_t i = 0U; i < count; ++i) {
+					
+					m_Dictionary.emplace_back(_reader.Bytes(_reader.Value<uint32_t>()));
+					
+					if (i != 0U) {
+						m_Lookup.emplace(m_Dictionary.back(), static_cast<uint16_t>(i));
+					}
+				}
+				
+				// Reject codes that would address entries outside of the dictionary.
+				for (const auto& code : m_Codes) {
+					
+					if (code != 0U && code >= m_Dictionary.size()) {
+						throw std::runtime_error("Binary cache contains an invalid symbol column!");
+					}
+				}
+			}
+			
+		public:
+			
+			/** @brief The type returned when accessing a value. */
+			using value_type = std::string_view;
+			
+			/**
+			 * @brief Returns the number of rows in the column.
+			 * @return The number of rows.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Codes.size();
+			}
+			
+			/**
+			 * @brief Returns whether the value of a row is present.
+			 * @param[in] _index The index of the row.
+			 * @return True if the string is not empty, false otherwise.
+			 */
+			[[nodiscard]] bool HasValue(const size_t& _index) const noexcept {
+				return m_Codes[_index] != 0U;
+			}
+			
+			/**
+			 * @brief Returns the string of a row.
+			 * @param[in] _index The index of the row.
+			 * @return A std::string_view referencing the dictionary, which is empty if the value is not present.
+			 */
+			[[nodiscard]] std::string_view operator[](const size_t& _index) const noexcept {
+				
+				return m_Codes[_index] == 0U ?
+					std::string_view() :
+					std::string_view(m_Dictionary[m_Codes[_index]]);
+			}
+			
+			/**
+			 * @brief Returns the string of a row if it is present.
+			 * @param[in] _index The index of the row.
+			 * @return An optional containing a std::string_view referencing the dictionary, or an empty optional if the value is not present.
+			 */
+			[[nodiscard]] std::optional<std::string_view> Get(const size_t& _index) const noexcept {
+				
+				return HasValue(_index) ?
+					std::optional<std::string_view>((*this)[_index]) :
+					std::optional<std::string_view>(std::nullopt);
+			}
+			
+			/**
+			 * @brief Returns the dictionary code of a row.
+			 * @param[in] _index The index of the row.
+			 * @return The code of the row, where 0 denotes an empty value.
+			 */
+			[[nodiscard]] uint16_t Code(const size_t& _index) const noexcept {
+				return m_Codes[_index];
+			}
+			
+			/**
+			 * @brief Returns a pointer to the contiguous dictionary codes of the column.
+			 * @return A pointer to Size() codes.
+			 */
+			[[nodiscard]] const uint16_t* Codes() const noexcept {
+				return m_Codes.data();
+			}
+			
+			/**
+			 * @brief Returns the dictionary of the column.
+			 *
+			 * Element i of the dictionary holds the string denoted by code i. If the column holds any non-empty value, element 0 is the empty string.
+			 *
+			 * @return A reference to the dictionary.
+			 */
+			[[nodiscard]] const std::vector<std::string>& Dictionary() const noexcept {
+				return m_Dictionary;
+			}
+			
+			/**
+			 * @brief Returns the number of rows whose value is present.
+			 * @return The number of non-zero codes.
+			 */
+			[[nodiscard]] size_t Count() const noexcept {
+				return m_Codes.size() - static_cast<size_t>(std::count(m_Codes.begin(), m_Codes.end(), static_cast<uint16_t>(0U)));
+			}
+		};
+		
+		/**
+		 * @class Catalogue
+		 * @brief Columnar (structure-of-arrays) storage for the stars of an ATHYG dataset version.
+		 *
+		 * Each numeric field is stored as a Column: a contiguous array of values with a separate validity bitmap,
+		 * in place of the std::optional members of V1, V2 and V3. Bulk access to a handful of fields
+		 * (e.g. x0, y0, z0 and mag) therefore only touches the memory of those fields.
+		 *
+		 * Text fields are packed into a per-column arena (TextColumn), and low-cardinality text fields such as
+		 * con and the *_src tags are interned into a dictionary of 16-bit codes (SymbolColumn), so loading
+		 * a catalogue allocates a handful of buffers per column rather than one string per star and field.
+		 *
+		 * Rows are stored in file order, then row order, and are indexed identically across every column.
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @see Column
+		 * @see TextColumn
+		 * @see SymbolColumn
+		 */
+		template <typename T>
+		class Catalogue final {
+			
+			static_assert(IsVersion<T>::value, "Template argument must be an ATHYG version!");
+			
+			static_assert(Ordered<T>(std::make_index_sequence<T::s_ElementCount>()), "Schema must be ordered by column index!");
+			
+			friend ATHYG;
+			
+		public:
+			
+			/**
+			 * @struct Derived
+			 * @brief Columns derived from the fields of every star by Derive, as 32-bit floats ready for rendering or querying.
+			 *
+			 * Each column has one value per star, which is NaN if the fields it is derived from are not present.
+			 * A column is empty if the catalogue does not contain the fields it is derived from, or if Derive has not been called.
+			 */
+			struct Derived final {
+				
+				/** @brief The unit vector towards each star (in the frame of x0, y0 and z0), from ra and dec, or from x0, y0 and z0 if either is not present. */
+				std::vector<float> dx, dy, dz;
+				
+				/** @brief The position of each star (x0, y0 and z0), in parsecs. */
+				std::vector<float> x, y, z;
+				
+				/** @brief The luminosity of each star in the V band, in solar luminosities, from absmag. */
+				std::vector<float> luminosity;
+				
+				/** @brief The effective temperature of each star in kelvin, from the B-V colour index (ci) using the formula of Ballesteros (2012). V3 only. */
+				std::vector<float> temperature;
+				
+				/** @brief The colour of a black body at the temperature of each star, as sRGB components in [0, 1]. V3 only. */
+				std::vector<float> r, g, b;
+			};
+			
+		private:
+			
+			template <typename U>
+			using ColumnOf = std::conditional_t<std::is_same_v<U, Symbol>,      SymbolColumn,
+			                 std::conditional_t<std::is_same_v<U, std::string>, TextColumn,
+			                                                                    Column<U>>>;
+			
+			template <typename... Ts>
+			static std::tuple<ColumnOf<Ts>...> Columns(const std::tuple<Ts...>*);
+			
+			/** @brief A tuple containing one Column per field, ordered by column index. */
+			decltype(Columns(static_cast<const typename T::Types*>(nullptr))) m_Columns;
+			
+			size_t m_Size;
+			
+			/** @brief The projection mask the catalogue was loaded with, where bit i is set if the field at column index i was parsed. */
+			uint64_t m_Mask;
+			
+			/** @brief The source files of the catalogue, in file order. */
+			std::vector<Input> m_Inputs;
+			
+			/** @brief The derived columns, computed by Derive. */
+			Derived m_Derived;
+			
+			/** @brief The tag identifying the ATHYG version in a binary cache. */
+			static constexpr uint32_t s_Version { T::s_Version };
+			
+			/** @brief The number of rows in each task of a column-wise pass over the catalogue. */
+			static constexpr size_t s_BlockRows { 65536U };
+			
+			/**
+			 * @brief Invokes a function for consecutive blocks of s_BlockRows rows or fewer, covering every row of the catalogue.
+			 *
+			 * With a single thread, every block is processed on the calling thread without allocating. Otherwise, the threads are started (and joined) by ParallelFor on every call.
+			 *
+			 * @param[in] _threads The number of threads to use, or 0 to use every hardware thread.
+			 * @param[in] _func The function to invoke with the first row of each block and one past its last row.
+			 */
+			template <typename F>
+			void Blocks(const size_t& _threads, F&& _func) const {
+				
+				const auto threads = _threads == 0U ?
+					static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)) :
+					_threads;
+				
+				ParallelFor((m_Size + s_BlockRows - 1U) / s_BlockRows, threads, [this, &_func](const size_t& _block) {
+					
+					const auto begin = _block * s_BlockRows;
+					
+					_func(begin, std::min(begin + s_BlockRows, m_Size));
+				});
+			}
+			
+			template <uint64_t _Mask, size_t... Is>
+			void Reserve(const size_t& _capacity, std::index_sequence<Is...>) {
+				((((_Mask >> Is) & 1U) != 0U ? std::get<Is>(m_Columns).Reserve(_capacity) : void()), ...);
+			}
+			
+			template <uint64_t _Mask>
+			void Reserve(const size_t& _capacity) {
+				Reserve<_Mask>(_capacity, std::make_index_sequence<T::s_ElementCount>());
+			}
+			
+			template <uint64_t _Mask, size_t I>
+			void Reserve(const size_t& _capacity, const std::vector<Catalogue>& _parts) {
+				
+				if constexpr (((_Mask >> I) & 1U) != 0U) {
+					
+					auto& column = std::get<I>(m_Columns);
+					
+					if constexpr (std::is_same_v<std::decay_t<decltype(column)>, TextColumn>) {
+						
+						auto chars = column.m_Chars.size();
+						
+						for (const auto& part : _parts) {
+							chars += std::get<I>(part.m_Columns).m_Chars.size();
+						}
+						
+						column.Reserve(_capacity, chars);
+					}
+					else {
+						column.Reserve(_capacity);
+					}
+				}
+			}
+			
+			template <uint64_t _Mask, size_t... Is>
+			void Reserve(const size_t& _capacity, const std::vector<Catalogue>& _parts, std::index_sequence<Is...>) {
+				(Reserve<_Mask, Is>(_capacity, _parts), ...);
+			}
+			
+			/**
+			 * @brief Reserves the selected columns for a number of rows, and the arena of each text column for the strings of the parts to be merged into it.
+			 * @param[in] _capacity The number of rows.
+			 * @param[in] _parts The catalogues to be merged into this one.
+			 */
+			template <uint64_t _Mask>
+			void Reserve(const size_t& _capacity, const std::vector<Catalogue>& _parts) {
+				Reserve<_Mask>(_capacity, _parts, std::make_index_sequence<T::s_ElementCount>());
+			}
+			
+			template <size_t... Is>
+			void Place(const size_t& _rows, std::index_sequence<Is...>) const noexcept {
+				(std::get<Is>(m_Columns).Place(_rows), ...);
+			}
+			
+			/**
+			 * @brief Spreads the memory of every column evenly across the NUMA nodes, so that each partition of a number of rows is local to its node.
+			 * @param[in] _rows The number of rows to partition, which may exceed the size of the catalogue if it has been reserved.
+			 * @see Partition(const size_t&) const
+			 */
+			void Place(const size_t& _rows) const noexcept {
+				Place(_rows, std::make_index_sequence<T::s_ElementCount>());
+			}
+			
+			template <uint64_t _Mask, size_t... Is>
+			void Emplace(const std::array<std::string_view, T::s_ElementCount>& _fields, std::index_sequence<Is...>) {
+				
+				// Columns of fields that are not selected are left empty.
+				((((_Mask >> Is) & 1U) != 0U ? std::get<Is>(m_Columns).Push(_fields[Is]) : void()), ...);
+			}
+			
+			template <uint64_t _Mask>
+			void Emplace(const std::array<std::string_view, T::s_ElementCount>& _fields) {
+				Emplace<_Mask>(_fields, std::make_index_sequence<T::s_ElementCount>());
+				++m_Size;
+			}
+			
+			template <size_t... Is>
+			void Merge(Catalogue&& _other, std::index_sequence<Is...>) {
+				(std::get<Is>(m_Columns).Append(std::move(std::get<Is>(_other.m_Columns))), ...);
+			}
+			
+			void Merge(Catalogue&& _other) {
+				Merge(std::move(_other), std::make_index_sequence<T::s_ElementCount>());
+				m_Size += _other.m_Size;
+				m_Mask |= _other.m_Mask;
+				m_Inputs.insert(m_Inputs.end(), _other.m_Inputs.begin(), _other.m_Inputs.end());
+			}
+			
+			template <size_t... Is>
+			void Copy(const Catalogue& _other, const size_t& _begin, const size_t& _count, std::index_sequence<Is...>) {
+				
+				// Columns of fields that are not selected are left empty.
+				((((m_Mask >> Is) & 1U) != 0U ? std::get<Is>(m_Columns).Copy(std::get<Is>(_other.m_Columns), _begin, _count) : void()), ...);
+			}
+			
+			/**
+			 * @brief Appends a range of rows of another catalogue with the same mask.
+			 * @param[in] _other The catalogue.
+			 * @param[in] _begin The index of the first row to copy.
+			 * @param[in] _count The number of rows to copy.
+			 */
+			void Copy(const Catalogue& _other, const size_t& _begin, const size_t& _count) {
+				Copy(_other, _begin, _count, std::make_index_sequence<T::s_ElementCount>());
+				m_Size += _count;
+			}
+			
+			/**
+			 * @brief Returns the hash of the header and rows of a file, as recorded by each Input.
+			 * @param[in] _path The path to the file.
+			 * @param[in] _source The strategy used to read the file.
+			 * @return The hash of the file.
+			 */
+			[[nodiscard]] static uint64_t Hash(const std::filesystem::path& _path, const Source& _source) {
+				
+				Hasher hasher;
+				
+				const auto header = [&hasher](const std::string_view& _header) noexcept {
+					hasher.Update(_header);
+					hasher.Update("\n");
+				};
+				
+				ReadBlocks(_path, _source, s_ReadSize, header, [&hasher](const std::string_view& _block) {
+					hasher.Update(_block);
+					return true;
+				});
+				
+				return hasher.Digest();
+			}
+			
+			template <size_t... Is>
+			void WriteColumns(BinaryWriter& _writer, std::index_sequence<Is...>) const {
+				(std::get<Is>(m_Columns).Write(_writer), ...);
+			}
+			
+			template <size_t... Is>
+			void ReadColumns(BinaryReader& _reader, std::index_sequence<Is...>) {
+				(std::get<Is>(m_Columns).Read(_reader, m_Size), ...);
+			}
+			
+			/**
+			 * @brief Reads the header of a binary cache into the catalogue, leaving its columns empty.
+			 * @param[in] _reader The reader, positioned at the start of the cache.
+			 * @throws std::runtime_error If the cache was not written by this revision of the library for this ATHYG version.
+			 */
+			void ReadHeader(BinaryReader& _reader) {
+				
+				const auto magic = _reader.Bytes(s_CacheMagic.size());
+				
+				if (magic != std::string_view(s_CacheMagic.data(), s_CacheMagic.size())) {
+					throw std::runtime_error("File is not an ATHYG binary cache!");
+				}
+				
+				const auto format  = _reader.Value<uint32_t>();
+				const auto version = _reader.Value<uint32_t>();
+				const auto count   = _reader.Value<uint32_t>();
+				const auto inputs  = _reader.Value<uint32_t>();
+				
+				if (format != s_CacheFormat || version != s_Version || count != T::s_ElementCount) {
+					throw std::runtime_error("Binary cache does not match the layout of the ATHYG version!");
+				}
+				
+				m_Size = static_cast<size_t>(_reader.Value<uint64_t>());
+				m_Mask = _reader.Value<uint64_t>();
+				
+				// Check the bounds before allocating, so a corrupt count cannot exhaust memory.
+				if (inputs > _reader.Remaining() / (3U * sizeof(uint64_t))) {
+					throw std::runtime_error("Unexpected end of binary cache!");
+				}
+				
+				m_Inputs.resize(inputs);
+				
+				for (auto& input : m_Inputs) {
+					input.size = _reader.Value<uint64_t>();
+					input.hash = _reader.Value<uint64_t>();
+					input.rows = _reader.Value<uint64_t>();
+				}
+			}
+			
+			/**
+			 * @brief Returns whether the source files recorded by the catalogue are identical to the given files.
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _options The options used to read the files.
+			 * @return True if every file has the recorded size and hash, false otherwise.
+			 */
+			[[nodiscard]] bool Current(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options) const {
+				
+				if (m_Inputs.size() != _athyg_paths.size()) {
+					return false;
+				}
+				
+				// Compare sizes before hashing, so most changes are detected without reading the files.
+				for (size_t i = 0U; i < _athyg_paths.size(); ++i) {
+					
+					std::error_code error;
+					
+					if (std::filesystem::file_size(_athyg_paths[i], error) != m_Inputs[i].size || error) {
+						return false;
+					}
+				}
+				
+				std::vector<uint64_t> hashes(_athyg_paths.size());
+				
+				const auto threads = _options.threads == 0U ?
+					std::max(std::thread::hardware_concurrency(), 1U) :
+					_options.threads;
+				
+				ParallelFor(hashes.size(), threads, [&](const size_t& _i) {
+					hashes[_i] = Hash(_athyg_paths[_i], _options.source);
+				});
+				
+				for (size_t i = 0U; i < hashes.size(); ++i) {
+					
+					if (hashes[i] != m_Inputs[i].hash) {
+						return false;
+					}
+				}
+				
+				return true;
+			}
+			
+			/**
+			 * @brief Returns the value of each field of an Interleaved layout for a row.
+			 */
+			template <typename I, size_t... Is>
+			[[nodiscard]] std::array<std::optional<double>, I::s_Count> Values(const size_t& _row, std::index_sequence<Is...>) const noexcept {
+				
+				const auto value = [&_row](const auto& _column) noexcept {
+					
+					return _column.HasValue(_row) ?
+						std::optional<double>(static_cast<double>(_column[_row])) :
+						std::nullopt;
+				};
+				
+				return { value(std::get<I::s_Fields[Is]>(m_Columns))... };
+			}
+			
+			/**
+			 * @brief Writes the fields of a sequence of rows to a buffer of interleaved vertices.
+			 * @param[in] _row A function returning the index of the i-th row to write.
+			 */
+			template <typename I, typename F>
+			size_t Pack(const size_t& _count, F&& _row, void* _buffer, const size_t& _size, const Missing& _missing, const size_t& _stride) const {
+				
+				static_assert(std::is_same_v<typename I::Version, T>, "Layout must select fields of the same ATHYG version!");
+				
+				for (const auto& field : I::s_Fields) {
+					
+					if (((m_Mask >> field) & 1U) == 0U) {
+						throw std::runtime_error("Catalogue does not contain the \"" + std::string(T::s_Names[field]) + "\" field!");
+					}
+				}
+				
+				Packer<I> result(_buffer, _size, _stride, _missing);
+				
+				for (size_t i = 0U; i < _count; ++i) {
+					result.Push(Values<I>(_row(i), std::make_index_sequence<I::s_Count>()));
+				}
+				
+				return result.Size();
+			}
+			
+		public:
+			
+			Catalogue() noexcept :
+				m_Columns(),
+				m_Size(0U),
+				m_Mask(0U),
+				m_Inputs(),
+				m_Derived() {}
+			
+			/**
+			 * @brief Load and parse ATHYG dataset files into a columnar catalogue.
+			 *
+			 * Behaves identically to ATHYG::Load, but stores the result column-wise.
+			 * If a projection is given, the columns of fields that are not selected are left empty.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _options The options used to read and parse the files.
+			 * @return A catalogue containing the deserialised data of every file.
+			 * @throw std::runtime_error If the number of elements in a CSV line
+			 * is not consistent with the ATHYG version.
+			 * @throw std::runtime_error If the specified path is not valid.
+			 * @throw std::runtime_error If a file cannot be memory-mapped.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+			 *
+			 * @note The source files are only hashed when loading with a binary cache, so a catalogue loaded without one (or missing malformed rows)
+			 * can be saved, but is never considered up to date by a cached Load, and is parsed in full by Reload.
+			 *
+			 * @see ATHYG::Load(const std::vector<std::filesystem::path>&, const Options&)
+			 */
+			template <typename P = Projection<T>, Errors E = Errors::Throw>
+			static Catalogue Load(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options) {
+				return Read<T, P, Catalogue, E>(_athyg_paths, _options);
+			}
+			
+			/**
+			 * @brief Load and parse the stars of ATHYG dataset files which satisfy a filter into a columnar catalogue.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _options The options used to read and parse the files.
+			 * @param[in] _filter The filter each star must satisfy to be loaded.
+			 * @return A catalogue containing the deserialised data of every star which satisfies the filter.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 * @tparam E (optional) The policy for malformed rows. Defaults to throwing.
+			 *
+			 * @note A filtered catalogue can be saved, but is never considered up to date by a cached Load.
+			 *
+			 * @see ATHYG::Load(const std::vector<std::filesystem::path>&, const Options&, const Filter<T>&)
+			 */
+			template <typename P = Projection<T>, Errors E = Errors::Throw>
+			static Catalogue Load(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options, const Filter<T>& _filter) {
+				
+				return _filter.Empty() ?
+					Read<T, P, Catalogue, E>(_athyg_paths, _options) :
+					Read<T, P, Catalogue, E>(_athyg_paths, _options, _filter);
+			}
+			
+			/**
+			 * @brief Load and parse ATHYG dataset files into a columnar catalogue using the default options.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @return A catalogue containing the deserialised data of every file.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 *
+			 * @see Load(const std::vector<std::filesystem::path>&, const Options&)
+			 */
+			template <typename P = Projection<T>>
+			static Catalogue Load(const std::vector<std::filesystem::path>& _athyg_paths) {
+				return Load<P>(_athyg_paths, Options());
+			}
+			
+			/**
+			 * @brief Load ATHYG dataset files into a columnar catalogue, using a binary cache when it is up to date.
+			 *
+			 * If the cache exists, was written for the same ATHYG version and projection, and the size and hash of every file
+			 * match those recorded in the cache, the catalogue is read from the cache without parsing any CSV.
+			 * Otherwise, the files are parsed and the cache is (re)written.
+			 *
+			 * @code
+			 * const auto catalogue = ATHYG::Catalogue<ATHYG::V3>::Load({ "athyg_v3-1.csv", "athyg_v3-2.csv" }, "athyg_v3.bin");
+			 * @endcode
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _cache_path The path to the binary cache.
+			 * @param[in] _options The options used to read and parse the files.
+			 * @return A catalogue containing the deserialised data of every file.
+			 * @throw std::runtime_error If the files must be parsed, and Load(const std::vector<std::filesystem::path>&, const Options&) throws.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 *
+			 * @note The cache is an optimisation, so a cache that is corrupt or cannot be written does not cause the load to fail.
+			 *
+			 * @see Save(const std::filesystem::path&) const
+			 */
+			template <typename P = Projection<T>>
+			static Catalogue Load(const std::vector<std::filesystem::path>& _athyg_paths, const std::filesystem::path& _cache_path, const Options& _options) {
+				
+				if (exists(_cache_path)) {
+					
+					try {
+						
+						const MappedFile cache(_cache_path);
+						
+						BinaryReader reader(cache.View());
+						
+						Catalogue result;
+						result.ReadHeader(reader);
+						
+						if (result.m_Mask == P::s_Mask && result.Current(_athyg_paths, _options)) {
+							result.ReadColumns(reader, std::make_index_sequence<T::s_ElementCount>());
+							
+							if (_options.numa) {
+								result.Place(result.Size());
+							}
+							
+							return result;
+						}
+					}
+					catch (const std::exception&) {
+						// The cache is unreadable, so fall back to parsing.
+					}
+				}
+				
+				auto result = Read<T, P, Catalogue>(_athyg_paths, _options, Unfiltered(), true);
+				
+				try {
+					result.Save(_cache_path);
+				}
+				catch (const std::exception&) {
+					// The cache could not be written, but the catalogue is still valid.
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Load ATHYG dataset files into a columnar catalogue using the default options, using a binary cache when it is up to date.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _cache_path The path to the binary cache.
+			 * @return A catalogue containing the deserialised data of every file.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 *
+			 * @see Load(const std::vector<std::filesystem::path>&, const std::filesystem::path&, const Options&)
+			 */
+			template <typename P = Projection<T>>
+			static Catalogue Load(const std::vector<std::filesystem::path>& _athyg_paths, const std::filesystem::path& _cache_path) {
+				return Load<P>(_athyg_paths, _cache_path, Options());
+			}
+			
+			/**
+			 * @brief Loads a new catalogue from ATHYG dataset files, parsing only the files which have changed since this catalogue was loaded.
+			 *
+			 * Each file is matched to a source file of this catalogue by its size and the hash of its header and rows,
+			 * so a file whose header alone has changed (e.g. whose columns were renamed or reordered) is parsed again, under its new layout.
+			 * The rows of matched files are copied from this catalogue, and every other file is parsed, so files may be changed, added, removed or reordered.
+			 * Only files with the size of a source file are hashed. Every file is parsed if this catalogue was loaded with a different projection,
+			 * or does not record its source files, as it was loaded without a binary cache, was filtered or is missing malformed rows.
+			 *
+			 * This catalogue is not modified, so it can continue to serve readers on other threads while the new catalogue is built, then be replaced by it.
+			 * Indexes over this catalogue, such as an IdentifierIndex, must be recreated over the new catalogue.
+			 *
+			 * @code
+			 * auto catalogue = std::make_shared<const ATHYG::Catalogue<ATHYG::V3>>(ATHYG::Catalogue<ATHYG::V3>::Load(paths, "athyg_v3.bin"));
+			 *
+			 * // Once upstream republishes a part:
+			 * auto reloaded = std::make_shared<const ATHYG::Catalogue<ATHYG::V3>>(catalogue->Reload(paths, ATHYG::Options()));
+			 * reloaded->Save("athyg_v3.bin");
+			 *
+			 * std::atomic_store(&catalogue, std::move(reloaded));
+			 * @endcode
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @param[in] _options The options used to read and parse the files.
+			 * @return A catalogue containing the deserialised data of every file, identical to the result of Load.
+			 * @throw std::runtime_error If a changed file must be parsed, and Load(const std::vector<std::filesystem::path>&, const Options&) throws.
+			 * @throw std::runtime_error If the specified path is not valid.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 * @tparam E (optional) The policy for malformed rows of changed files. Defaults to throwing.
+			 */
+			template <typename P = Projection<T>, Errors E = Errors::Throw>
+			[[nodiscard]] Catalogue Reload(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options) const {
+				
+				size_t recorded = 0U;
+				
+				for (const auto& input : m_Inputs) {
+					recorded += static_cast<size_t>(input.rows);
+				}
+				
+				if (m_Mask != P::s_Mask || recorded != m_Size) {
+					return Read<T, P, Catalogue, E>(_athyg_paths, _options, Unfiltered(), true);
+				}
+				
+				for (const auto& path : _athyg_paths) {
+					
+					if (!exists(path)) {
+						throw std::runtime_error("Path is not valid.");
+					}
+				}
+				
+				// The index of the first row of each source file.
+				std::vector<size_t> starts(m_Inputs.size() + 1U, 0U);
+				
+				for (size_t i = 0U; i < m_Inputs.size(); ++i) {
+					starts[i + 1U] = starts[i] + static_cast<size_t>(m_Inputs[i].rows);
+				}
+				
+				// The source file matched by each file, if any. Files whose size does not match any source file must have changed, so are not hashed.
+				constexpr auto none = std::numeric_limits<size_t>::max();
+				
+				std::vector<size_t> matches(_athyg_paths.size(), none);
+				
+				const auto threads = _options.threads == 0U ?
+					std::max(std::thread::hardware_concurrency(), 1U) :
+					_options.threads;
+				
+				ParallelFor(_athyg_paths.size(), threads, [&](const size_t& _i) {
+					
+					const auto size = static_cast<uint64_t>(file_size(_athyg_paths[_i]));
+					
+					std::optional<uint64_t> hash;
+					
+					for (size_t j = 0U; j < m_Inputs.size(); ++j) {
+						
+						if (m_Inputs[j].size == size) {
+							
+							if (!hash.has_value()) {
+								hash = Hash(_athyg_paths[_i], _options.source);
+							}
+							
+							if (*hash == m_Inputs[j].hash) {
+								matches[_i] = j;
+								break;
+							}
+						}
+					}
+				});
+				
+				Catalogue result;
+				result.m_Mask = P::s_Mask;
+				
+				// Whether the source file of every row is recorded, so that the result can be reloaded in turn.
+				bool complete = true;
+				
+				for (size_t i = 0U; i < _athyg_paths.size(); ++i) {
+					
+					if (matches[i] != none) {
+						result.Copy(*this, starts[matches[i]], static_cast<size_t>(m_Inputs[matches[i]].rows));
+						result.m_Inputs.push_back(m_Inputs[matches[i]]);
+					}
+					else {
+						
+						auto parsed = Read<T, P, Catalogue, E>({ _athyg_paths[i] }, _options, Unfiltered(), true);
+						
+						complete = complete && parsed.m_Inputs.size() == 1U;
+						
+						result.Merge(std::move(parsed));
+					}
+				}
+				
+				if (!complete) {
+					result.m_Inputs.clear();
+				}
+				
+				if (_options.numa) {
+					result.Place(result.Size());
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Loads a new catalogue from ATHYG dataset files using the default options, parsing only the files which have changed since this catalogue was loaded.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV file.
+			 * @return A catalogue containing the deserialised data of every file.
+			 *
+			 * @tparam P (optional) The projection of fields to parse. Defaults to every field.
+			 *
+			 * @see Reload(const std::vector<std::filesystem::path>&, const Options&) const
+			 */
+			template <typename P = Projection<T>>
+			[[nodiscard]] Catalogue Reload(const std::vector<std::filesystem::path>& _athyg_paths) const {
+				return Reload<P>(_athyg_paths, Options());
+			}
+			
+			/**
+			 * @brief Reads a catalogue from a binary cache, without checking whether its source files have changed.
+			 *
+			 * The cache is memory-mapped and its columns are copied directly into the catalogue, so no CSV parsing takes place.
+			 *
+			 * @param[in] _cache_path The path to the binary cache.
+			 * @return The catalogue stored in the cache.
+			 * @throw std::runtime_error If the cache cannot be mapped, is corrupt, or was written for a different ATHYG version or revision of the library.
+			 *
+			 * @see Save(const std::filesystem::path&) const
+			 */
+			static Catalogue Open(const std::filesystem::path& _cache_path) {
+				
+				const MappedFile cache(_cache_path);
+				
+				BinaryReader reader(cache.View());
+				
+				Catalogue result;
+				result.ReadHeader(reader);
+				result.ReadColumns(reader, std::make_index_sequence<T::s_ElementCount>());
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Writes the catalogue to a binary cache.
+			 *
+			 * The cache is a little-endian file consisting of a header followed by every column in column index order:
+			 *
+			 * | Section | Contents |
+			 * |---------|----------|
+			 * | Header  | "ATHYGBIN", format revision (u32), ATHYG version (u32), s_ElementCount (u32), file count (u32), row count (u64), projection mask (u64). |
+			 * | Files   | Per source file: size in bytes (u64), XXH64 hash of the contents (u64), row count (u64). |
+			 * | Columns | Per column: kind (u32), value width (u32), row count (u64, 0 if not parsed), then the payload of the column. |
+			 *
+			 * Column payloads and arrays within them are aligned to 8 bytes. Numeric columns store their values followed by their validity bitmap,
+			 * text columns store their offsets followed by their arena, and symbol columns store their codes followed by their dictionary.
+			 *
+			 * The cache is written to a temporary file which then replaces the cache, so readers never observe a partially written cache.
+			 *
+			 * @param[in] _cache_path The path to the binary cache.
+			 * @throw std::runtime_error If the cache cannot be written.
+			 *
+			 * @see Open(const std::filesystem::path&)
+			 */
+			void Save(const std::filesystem::path& _cache_path) const {
+				
+				auto temporary = _cache_path;
+				temporary += ".tmp";
+				
+				try {
+					
+					BinaryWriter writer(temporary);
+					
+					writer.Bytes(s_CacheMagic.data(), s_CacheMagic.size());
+					writer.Value(s_CacheFormat);
+					writer.Value(s_Version);
+					writer.Value(static_cast<uint32_t>(T::s_ElementCount));
+					writer.Value(static_cast<uint32_t>(m_Inputs.size()));
+					writer.Value(static_cast<uint64_t>(m_Size));
+					writer.Value(m_Mask);
+					
+					for (const auto& input : m_Inputs) {
+						writer.Value(input.size);
+						writer.Value(input.hash);
+						writer.Value(input.rows);
+					}
+					
+					WriteColumns(writer, std::make_index_sequence<T::s_ElementCount>());
+					
+					writer.Close();
+					
+					std::filesystem::rename(temporary, _cache_path);
+				}
+				catch (...) {
+					
+					std::error_code error;
+					std::filesystem::remove(temporary, error);
+					
+					throw;
+				}
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the catalogue.
+			 * @return The number of rows.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Size;
+			}
+			
+			/**
+			 * @brief Returns whether the catalogue contains no stars.
+			 * @return True if there are no rows, false otherwise.
+			 */
+			[[nodiscard]] bool Empty() const noexcept {
+				return m_Size == 0U;
+			}
+			
+			/**
+			 * @brief Returns the rows of the catalogue which are local to a NUMA node, if it was loaded with Options::numa.
+			 *
+			 * Rows are divided between the nodes in order, so a query thread which scans the rows of its own node only reads local memory.
+			 *
+			 * @code
+			 * // On each query thread:
+			 * const auto [begin, end] = catalogue.Partition();
+			 *
+			 * for (auto i = begin; i < end; ++i) {
+			 *     // ...
+			 * }
+			 * @endcode
+			 *
+			 * @param[in] _node The node.
+			 * @return The index of the first row of the partition and one past its last row, which are equal if the node does not exist.
+			 * If the machine has a single node, its partition is every row.
+			 */
+			[[nodiscard]] std::pair<size_t, size_t> Partition(const size_t& _node) const noexcept {
+				
+				const auto nodes = Nodes();
+				
+				return _node < nodes ?
+					std::make_pair((m_Size * _node) / nodes, (m_Size * (_node + 1U)) / nodes) :
+					std::make_pair(m_Size, m_Size);
+			}
+			
+			/**
+			 * @brief Returns the rows of the catalogue which are local to the NUMA node of the calling thread, if it was loaded with Options::numa.
+			 * @return The index of the first row of the partition and one past its last row.
+			 * @see Partition(const size_t&) const
+			 */
+			[[nodiscard]] std::pair<size_t, size_t> Partition() const noexcept {
+				return Partition(Node());
+			}
+			
+			/**
+			 * @brief Returns the column of a field.
+			 *
+			 * @code
+			 * const auto& x0 = catalogue.template Get<ATHYG::V3::Field::x0>();
+			 * @endcode
+			 *
+			 * @tparam F The field.
+			 * @return A reference to the column holding the field of every star.
+			 */
+			template <typename T::Field F>
+			[[nodiscard]] const auto& Get() const noexcept {
+				return std::get<static_cast<size_t>(F)>(m_Columns);
+			}
+			
+			/**
+			 * @brief Returns whether a field was parsed when the catalogue was loaded.
+			 * @param[in] _field The field.
+			 * @return True if the column of the field is populated, false if it was excluded by a projection.
+			 */
+			[[nodiscard]] bool Has(const typename T::Field& _field) const noexcept {
+				return ((m_Mask >> static_cast<size_t>(_field)) & 1U) != 0U;
+			}
+			
+			/**
+			 * @brief Computes the derived columns of the catalogue from its fields, replacing any computed previously.
+			 *
+			 * Each derived column is computed in a separate pass over blocks of rows, so that the loops are free of branches on the validity of other columns and can be vectorised by the compiler.
+			 *
+			 * @code
+			 * auto catalogue = ATHYG::Catalogue<ATHYG::V3>::Load({ "athyg_v31.csv" });
+			 * catalogue.Derive(0U);
+			 *
+			 * const auto& derived = catalogue.Derivatives();
+			 * @endcode
+			 *
+			 * @param[in] _threads (optional) The number of threads used to compute the columns, or 0 to use every hardware thread. Defaults to 1.
+			 *
+			 * @note Derived columns are not written by Save or Export, and are not retained by Reload. Call Derive again after reloading.
+			 * @see Derived
+			 */
+			void Derive(const size_t& _threads = 1U) {
+				
+				using F = typename T::Field;
+				
+				const auto nan = std::numeric_limits<float>::quiet_NaN();
+				
+				const bool positions   = Has(F::x0) && Has(F::y0) && Has(F::z0);
+				const bool coordinates = Has(F::ra) && Has(F::dec);
+				const bool magnitudes  = Has(F::absmag);
+				
+				bool colours = false;
+				
+				if constexpr (std::is_same_v<T, V3>) {
+					colours = Has(F::ci);
+				}
+				
+				Derived result;
+				
+				if (positions || coordinates) {
+					result.dx.resize(m_Size);
+					result.dy.resize(m_Size);
+					result.dz.resize(m_Size);
+				}
+				
+				if (positions) {
+					result.x.resize(m_Size);
+					result.y.resize(m_Size);
+					result.z.resize(m_Size);
+				}
+				
+				if (magnitudes) {
+					result.luminosity.resize(m_Size);
+				}
+				
+				if (colours) {
+					result.temperature.resize(m_Size);
+					result.r.resize(m_Size);
+					result.g.resize(m_Size);
+					result.b.resize(m_Size);
+				}
+				
+				Blocks(_threads, [&](const size_t& _begin, const size_t& _end) {
+					
+					if (positions) {
+						
+						const auto& x0 = Get<F::x0>();
+						const auto& y0 = Get<F::y0>();
+						const auto& z0 = Get<F::z0>();
+						
+						for (auto i = _begin; i < _end; ++i) {
+							
+							const bool valid = x0.HasValue(i) && y0.HasValue(i) && z0.HasValue(i);
+							
+							result.x[i] = valid ? static_cast<float>(x0[i]) : nan;
+							result.y[i] = valid ? static_cast<float>(y0[i]) : nan;
+							result.z[i] = valid ? static_cast<float>(z0[i]) : nan;
+							
+							const auto length = std::sqrt((x0[i] * x0[i]) + (y0[i] * y0[i]) + (z0[i] * z0[i]));
+							const auto scale  = valid && length > 0.0 ? 1.0 / length : std::numeric_limits<double>::quiet_NaN();
+							
+							result.dx[i] = static_cast<float>(x0[i] * scale);
+							result.dy[i] = static_cast<float>(y0[i] * scale);
+							result.dz[i] = static_cast<float>(z0[i] * scale);
+						}
+					}
+					else if (coordinates) {
+						std::fill(result.dx.begin() + _begin, result.dx.begin() + _end, nan);
+						std::fill(result.dy.begin() + _begin, result.dy.begin() + _end, nan);
+						std::fill(result.dz.begin() + _begin, result.dz.begin() + _end, nan);
+					}
+					
+					// Directions from the coordinates take precedence over those from the positions, which are only defined for stars with a known distance.
+					if (coordinates) {
+						
+						const auto& ra  = Get<F::ra>();
+						const auto& dec = Get<F::dec>();
+						
+						for (auto i = _begin; i < _end; ++i) {
+							
+							if (ra.HasValue(i) && dec.HasValue(i)) {
+								
+								const auto a = ra[i]  * (s_Pi /  12.0);
+								const auto d = dec[i] * (s_Pi / 180.0);
+								
+								result.dx[i] = static_cast<float>(std::cos(d) * std::cos(a));
+								result.dy[i] = static_cast<float>(std::cos(d) * std::sin(a));
+								result.dz[i] = static_cast<float>(std::sin(d));
+							}
+						}
+					}
+					
+					if (magnitudes) {
+						
+						const auto& absmag = Get<F::absmag>();
+						
+						// The absolute magnitude of the Sun in the V band.
+						static constexpr double s_Sun { 4.83 };
+						
+						for (auto i = _begin; i < _end; ++i) {
+							result.luminosity[i] = absmag.HasValue(i) ? static_cast<float>(std::pow(10.0, 0.4 * (s_Sun - absmag[i]))) : nan;
+						}
+					}
+					
+					if constexpr (std::is_same_v<T, V3>) {
+						
+						if (colours) {
+							
+							const auto& ci = Get<F::ci>();
+							
+							for (auto i = _begin; i < _end; ++i) {
+								
+								const auto temperature = 4600.0 * ((1.0 / ((0.92 * ci[i]) + 1.7)) + (1.0 / ((0.92 * ci[i]) + 0.62)));
+								
+								result.temperature[i] = ci.HasValue(i) && temperature > 0.0 ? static_cast<float>(temperature) : nan;
+							}
+							
+							// The colour of a black body, from the approximation of Tanner Helland (2012).
+							for (auto i = _begin; i < _end; ++i) {
+								
+								const auto t = static_cast<double>(result.temperature[i]) / 100.0;
+								
+								const auto r = t <= 66.0 ? 255.0 : 329.698727446 * std::pow(t - 60.0, -0.1332047592);
+								const auto g = t <= 66.0 ?
+									(99.4708025861 * std::log(t)) - 161.1195681661 :
+									288.1221695283 * std::pow(t - 60.0, -0.0755148492);
+								const auto b = t >= 66.0 ? 255.0 : t <= 19.0 ? 0.0 : (138.5177312231 * std::log(t - 10.0)) - 305.0447927307;
+								
+								const bool valid = !std::isnan(t);
+								
+								result.r[i] = valid ? static_cast<float>(std::clamp(r, 0.0, 255.0) / 255.0) : nan;
+								result.g[i] = valid ? static_cast<float>(std::clamp(g, 0.0, 255.0) / 255.0) : nan;
+								result.b[i] = valid ? static_cast<float>(std::clamp(b, 0.0, 255.0) / 255.0) : nan;
+							}
+						}
+					}
+				});
+				
+				m_Derived = std::move(result);
+			}
+			
+			/**
+			 * @brief Returns the derived columns of the catalogue.
+			 * @return A reference to the columns computed by the last call to Derive, which are empty if it has not been called.
+			 * @see Derive
+			 */
+			[[nodiscard]] const Derived& Derivatives() const noexcept {
+				return m_Derived;
+			}
+			
+			/**
+			 * @brief Computes the Cartesian position of every star at another epoch, from its position (x0, y0, z0) and velocity (vx, vy, vz).
+			 *
+			 * Positions are advanced linearly, in fixed-size blocks of rows whose loops are free of branches and can be vectorised by the compiler.
+			 *
+			 * @code
+			 * std::vector<float> x(catalogue.Size()), y(catalogue.Size()), z(catalogue.Size());
+			 *
+			 * // The positions of the stars 10,000 years after the epoch of the catalogue.
+			 * catalogue.Propagate(10000.0, x.data(), y.data(), z.data());
+			 * @endcode
+			 *
+			 * @tparam O The floating-point type of the output.
+			 * @param[in] _years The time from the epoch of the catalogue, in years. May be negative.
+			 * @param[out] _x The buffer to write the x coordinate of each star to, in parsecs. Must hold Size() values.
+			 * @param[out] _y The buffer to write the y coordinate of each star to, in parsecs. Must hold Size() values.
+			 * @param[out] _z The buffer to write the z coordinate of each star to, in parsecs. Must hold Size() values.
+			 * @param[in] _threads (optional) The number of threads to use, or 0 to use every hardware thread. Defaults to 1.
+			 * @throw std::runtime_error If the catalogue does not contain the positions of its stars.
+			 *
+			 * @note Stars without a position are written as NaN. Stars without a velocity, including every star if the velocities were excluded by a projection, are treated as stationary.
+			 * @note Only a single thread propagates without allocating. Additional threads are started by each call, so are best suited to propagating large catalogues infrequently.
+			 */
+			template <typename O>
+			void Propagate(const double& _years, O* _x, O* _y, O* _z, const size_t& _threads = 1U) const {
+				
+				static_assert(std::is_floating_point_v<O>, "Output must be a floating-point type!");
+				static_assert(!std::is_same_v<T, V1>, "V1 does not contain the velocities of its stars!");
+				
+				using F = typename T::Field;
+				
+				if (!Has(F::x0) || !Has(F::y0) || !Has(F::z0)) {
+					throw std::runtime_error("Catalogue does not contain the positions of its stars!");
+				}
+				
+				const auto advance = [&_years](const auto& _position, const auto& _velocity, const bool& _moving, O* _output, const size_t& _begin, const size_t& _end) noexcept {
+					
+					const auto nan = std::numeric_limits<double>::quiet_NaN();
+					
+					for (auto i = _begin; i < _end; ++i) {
+						
+						const auto velocity = _moving && _velocity.HasValue(i) ? _velocity[i] : 0.0;
+						
+						_output[i] = static_cast<O>(_position.HasValue(i) ? _position[i] + (velocity * _years) : nan);
+					}
+				};
+				
+				const bool moving = Has(F::vx) && Has(F::vy) && Has(F::vz);
+				
+				Blocks(_threads, [&](const size_t& _begin, const size_t& _end) {
+					advance(Get<F::x0>(), Get<F::vx>(), moving, _x, _begin, _end);
+					advance(Get<F::y0>(), Get<F::vy>(), moving, _y, _begin, _end);
+					advance(Get<F::z0>(), Get<F::vz>(), moving, _z, _begin, _end);
+				});
+			}
+			
+			/**
+			 * @brief Computes the equatorial coordinates of every star at another epoch, from its coordinates (ra, dec) and proper motion (pm_ra, pm_dec).
+			 *
+			 * Each star is moved along the great circle of its proper motion, so that coordinates near the poles and across ra = 0 remain valid.
+			 * Radial velocity and the change in proper motion over time are not modelled.
+			 *
+			 * @tparam O The floating-point type of the output.
+			 * @param[in] _years The time from the epoch of the catalogue, in years. May be negative.
+			 * @param[out] _ra The buffer to write the right ascension of each star to, in hours within [0, 24). Must hold Size() values.
+			 * @param[out] _dec The buffer to write the declination of each star to, in degrees. Must hold Size() values.
+			 * @param[in] _threads (optional) The number of threads to use, or 0 to use every hardware thread. Defaults to 1.
+			 * @throw std::runtime_error If the catalogue does not contain the coordinates of its stars.
+			 *
+			 * @note The proper motion in right ascension is taken to include the factor of cos(dec), as in the Hipparcos and Gaia catalogues, in milliarcseconds per year.
+			 * @note Stars without coordinates are written as NaN. Stars without a proper motion, including every star if the proper motions were excluded by a projection, are treated as stationary.
+			 * @note Only a single thread propagates without allocating. Additional threads are started by each call, so are best suited to propagating large catalogues infrequently.
+			 */
+			template <typename O>
+			void PropagateCoordinates(const double& _years, O* _ra, O* _dec, const size_t& _threads = 1U) const {
+				
+				static_assert(std::is_floating_point_v<O>, "Output must be a floating-point type!");
+				static_assert(!std::is_same_v<T, V1>, "V1 does not contain the proper motions of its stars!");
+				
+				using F = typename T::Field;
+				
+				// Milliarcseconds to radians.
+				static constexpr double s_Scale { s_Pi / (180.0 * 3600.0 * 1000.0) };
+				
+				if (!Has(F::ra) || !Has(F::dec)) {
+					throw std::runtime_error("Catalogue does not contain the coordinates of its stars!");
+				}
+				
+				const bool moving = Has(F::pm_ra) && Has(F::pm_dec);
+				
+				Blocks(_threads, [&](const size_t& _begin, const size_t& _end) {
+					
+					const auto& ra     = Get<F::ra>();
+					const auto& dec    = Get<F::dec>();
+					const auto& pm_ra  = Get<F::pm_ra>();
+					const auto& pm_dec = Get<F::pm_dec>();
+					
+					for (auto i = _begin; i < _end; ++i) {
+						
+						const auto a = ra[i]  * (s_Pi /  12.0);
+						const auto d = dec[i] * (s_Pi / 180.0);
+						
+						const auto ca = std::cos(a), sa = std::sin(a);
+						const auto cd = std::cos(d), sd = std::sin(d);
+						
+						// The angular displacement, in radians, towards increasing right ascension and declination.
+						const auto p = moving && pm_ra.HasValue(i)  ? pm_ra[i]  * s_Scale * _years : 0.0;
+						const auto q = moving && pm_dec.HasValue(i) ? pm_dec[i] * s_Scale * _years : 0.0;
+						
+						const auto x = (cd * ca) - (p * sa) - (q * sd * ca);
+						const auto y = (cd * sa) + (p * ca) - (q * sd * sa);
+						const auto z =  sd                  + (q * cd);
+						
+						const bool valid = ra.HasValue(i) && dec.HasValue(i);
+						
+						auto hours = std::atan2(y, x) * (12.0 / s_Pi);
+						
+						// Small negative angles round to exactly 24 hours when wrapped.
+						if (hours < 0.0) {
+							hours = std::min(hours + 24.0, std::nextafter(24.0, 0.0));
+						}
+						
+						_ra[i]  = static_cast<O>(valid ? hours : std::numeric_limits<double>::quiet_NaN());
+						_dec[i] = static_cast<O>(valid ? std::atan2(z, std::sqrt((x * x) + (y * y))) * (180.0 / s_Pi) : std::numeric_limits<double>::quiet_NaN());
+					}
+				});
+			}
+			
+			/**
+			 * @brief Writes the fields of a range of stars to a buffer of interleaved vertices.
+			 *
+			 * The buffer may be a persistently mapped GPU staging buffer. Vertices are written whole and in order, and the bytes between vertices are not written.
+			 *
+			 * @code
+			 * using F = ATHYG::V3::Field;
+			 * using Vertex = ATHYG::Interleaved<ATHYG::V3, float, F::x0, F::y0, F::z0, F::absmag, F::ci>;
+			 *
+			 * // Upload the brightest stars first.
+			 * const ATHYG::MagnitudeOrder<ATHYG::V3> order(catalogue);
+			 *
+			 * const auto count = catalogue.template Export<Vertex>(order.Order().data(), order.Count(6.5), mapped, size);
+			 * @endcode
+			 *
+			 * @tparam I The Interleaved layout of each vertex.
+			 * @param[in] _rows The indices of the stars to write, in order.
+			 * @param[in] _count The number of indices.
+			 * @param[out] _buffer The buffer to write the vertices to.
+			 * @param[in] _size The size of the buffer in bytes.
+			 * @param[in] _missing (optional) The policy for fields without a value. Defaults to writing NaN.
+			 * @param[in] _stride (optional) The distance between the start of consecutive vertices in bytes. Defaults to the size of a vertex.
+			 * @return The number of vertices written.
+			 * @throw std::runtime_error If a field of the layout was excluded from the catalogue by a projection.
+			 * @throw std::runtime_error If the buffer is too small for every exported star.
+			 * @throw std::runtime_error If the stride is less than the size of a vertex.
+			 */
+			template <typename I>
+			size_t Export(const size_t* _rows, const size_t& _count, void* _buffer, const size_t& _size, const Missing& _missing = Missing::NaN, const size_t& _stride = I::s_Stride) const {
+				return Pack<I>(_count, [_rows](const size_t& _i) noexcept { return _rows[_i]; }, _buffer, _size, _missing, _stride);
+			}
+			
+			/**
+			 * @brief Writes the fields of every star to a buffer of interleaved vertices, in row order.
+			 *
+			 * @tparam I The Interleaved layout of each vertex.
+			 * @param[out] _buffer The buffer to write the vertices to.
+			 * @param[in] _size The size of the buffer in bytes.
+			 * @param[in] _missing (optional) The policy for fields without a value. Defaults to writing NaN.
+			 * @param[in] _stride (optional) The distance between the start of consecutive vertices in bytes. Defaults to the size of a vertex.
+			 * @return The number of vertices written.
+			 *
+			 * @see Export(const size_t*, const size_t&, void*, const size_t&, const Missing&, const size_t&)
+			 */
+			template <typename I>
+			size_t Export(void* _buffer, const size_t& _size, const Missing& _missing = Missing::NaN, const size_t& _stride = I::s_Stride) const {
+				return Pack<I>(m_Size, [](const size_t& _i) noexcept { return _i; }, _buffer, _size, _missing, _stride);
+			}
+		};
+		
+		/**
+		 * @class KDTree
+		 * @brief A spatial index over the Cartesian positions (x0, y0, z0) of the stars of a container.
+		 *
+		 * The tree is implicit: positions are stored contiguously in a single array, ordered such that the median of every range
+		 * splits it along the axis chosen by its depth. No child pointers are stored, and ranges of s_LeafSize or fewer positions are searched linearly.
+		 * Queries return the indices of stars within the container the tree was built from, so the tree remains valid for as long as the container is unchanged.
+		 *
+		 * @code
+		 * const auto stars = ATHYG::Load<ATHYG::V3>(paths);
+		 *
+		 * const ATHYG::KDTree<ATHYG::V3> tree(stars, 0U);
+		 *
+		 * // The ten nearest stars to the Sun, and every star within 10 parsecs of it.
+		 * const auto nearest = tree.Nearest({ 0.0, 0.0, 0.0 }, 10U);
+		 * const auto local   = tree.Radius({ 0.0, 0.0, 0.0 }, 10.0);
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @note Stars without a position are not indexed.
+		 */
+		template <typename T>
+		class KDTree final {
+			
+		public:
+			
+			/** @brief A position, in parsecs. */
+			using Point = std::array<double, 3U>;
+			
+			/** @brief The candidates of a nearest-neighbour search, as pairs of squared distance and index. */
+			using Heap = std::vector<std::pair<double, size_t>>;
+			
+		private:
+			
+			/** @brief The maximum number of positions in a range which is searched linearly, rather than split. */
+			static constexpr size_t s_LeafSize { 16U };
+			
+			struct Entry final {
+				
+				Point  position;
+				size_t index;
+			};
+			
+			std::vector<Entry> m_Entries;
+			
+			[[nodiscard]] static constexpr double Distance(const Point& _a, const Point& _b) noexcept {
+				
+				const auto x = _a[0U] - _b[0U];
+				const auto y = _a[1U] - _b[1U];
+				const auto z = _a[2U] - _b[2U];
+				
+				return (x * x) + (y * y) + (z * z);
+			}
+			
+			/**
+			 * @brief Moves the median of a range into the middle of the range, so it splits the range along the axis of its depth.
+			 * @return The index of the median.
+			 */
+			size_t Partition(const size_t& _begin, const size_t& _end, const size_t& _depth) {
+				
+				const auto axis   = _depth % 3U;
+				const auto median = _begin + ((_end - _begin) / 2U);
+				
+				std::nth_element(m_Entries.begin() + static_cast<std::ptrdiff_t>(_begin),
+				                 m_Entries.begin() + static_cast<std::ptrdiff_t>(median),
+				                 m_Entries.begin() + static_cast<std::ptrdiff_t>(_end),
+				                 [axis](const Entry& _a, const Entry& _b) noexcept { return _a.position[axis] < _b.position[axis]; });
+				
+				return median;
+			}
+			
+			/**
+			 * @brief Orders a range of the tree, splitting it recursively.
+			 *
+			 * The first _levels levels are split by the calling thread, and the ranges below them are appended to _tasks to be built separately.
+			 */
+			void Build(const size_t& _begin, const size_t& _end, const size_t& _depth, const size_t& _levels, std::vector<std::array<size_t, 3U>>& _tasks) {
+				
+				if (_end - _begin <= s_LeafSize) {
+					return;
+				}
+				
+				if (_levels == 0U) {
+					_tasks.push_back({ _begin, _end, _depth });
+				}
+				else {
+					
+					const auto median = Partition(_begin, _end, _depth);
+					
+					Build(_begin,       median, _depth + 1U, _levels - 1U, _tasks);
+					Build(median + 1U,  _end,   _depth + 1U, _levels - 1U, _tasks);
+				}
+			}
+			
+			void Build(const size_t& _begin, const size_t& _end, const size_t& _depth) {
+				
+				if (_end - _begin > s_LeafSize) {
+					
+					const auto median = Partition(_begin, _end, _depth);
+					
+					Build(_begin,      median, _depth + 1U);
+					Build(median + 1U, _end,   _depth + 1U);
+				}
+			}
+			
+			/**
+			 * @brief Builds the tree from the positions of a container.
+			 * @param[in] _threads The number of threads used to build the tree, or 0 to use every hardware thread.
+			 */
+			void Build(const size_t& _threads) {
+				
+				const auto threads = _threads == 0U ?
+					static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)) :
+					_threads;
+				
+				if (threads == 1U) {
+					Build(0U, m_Entries.size(), 0U);
+				}
+				else {
+					
+					// Split the top levels serially, into roughly four subtrees per thread, then build the subtrees in parallel.
+					size_t levels = 2U;
+					
+					while ((static_cast<size_t>(1U) << levels) < threads * 4U) {
+						++levels;
+					}
+					
+					std::vector<std::array<size_t, 3U>> tasks;
+					
+					Build(0U, m_Entries.size(), 0U, levels, tasks);
+					
+					ParallelFor(tasks.size(), threads, [this, &tasks](const size_t& _i) {
+						Build(tasks[_i][0U], tasks[_i][1U], tasks[_i][2U]);
+					});
+				}
+			}
+			
+			template <typename F>
+			void Radius(const size_t& _begin, const size_t& _end, const size_t& _depth, const Point& _centre, const double& _radius, const double& _squared, F& _func) const {
+				
+				if (_end - _begin <= s_LeafSize) {
+					
+					for (auto i = _begin; i < _end; ++i) {
+						
+						if (Distance(m_Entries[i].position, _centre) <= _squared) {
+							_func(m_Entries[i]);
+						}
+					}
+				}
+				else {
+					
+					const auto  median = _begin + ((_end - _begin) / 2U);
+					const auto& split  = m_Entries[median];
+					
+					const auto offset = _centre[_depth % 3U] - split.position[_depth % 3U];
+					
+					if (Distance(split.position, _centre) <= _squared) {
+						_func(split);
+					}
+					
+					if (offset <= _radius) {
+						Radius(_begin, median, _depth + 1U, _centre, _radius, _squared, _func);
+					}
+					
+					if (offset >= -_radius) {
+						Radius(median + 1U, _end, _depth + 1U, _centre, _radius, _squared, _func);
+					}
+				}
+			}
+			
+			void Within(const size_t& _begin, const size_t& _end, const size_t& _depth, const Point& _min, const Point& _max, std::vector<size_t>& _result) const {
+				
+				const auto contains = [&_min, &_max](const Point& _position) noexcept {
+					
+					return _position[0U] >= _min[0U] && _position[0U] <= _max[0U] &&
+					       _position[1U] >= _min[1U] && _position[1U] <= _max[1U] &&
+					       _position[2U] >= _min[2U] && _position[2U] <= _max[2U];
+				};
+				
+				if (_end - _begin <= s_LeafSize) {
+					
+					for (auto i = _begin; i < _end; ++i) {
+						
+						if (contains(m_Entries[i].position)) {
+							_result.push_back(m_Entries[i].index);
+						}
+					}
+				}
+				else {
+					
+					const auto  median = _begin + ((_end - _begin) / 2U);
+					const auto& split  = m_Entries[median];
+					const auto  axis   = _depth % 3U;
+					
+					if (contains(split.position)) {
+						_result.push_back(split.index);
+					}
+					
+					if (_min[axis] <= split.position[axis]) {
+						Within(_begin, median, _depth + 1U, _min, _max, _result);
+					}
+					
+					if (_max[axis] >= split.position[axis]) {
+						Within(median + 1U, _end, _depth + 1U, _min, _max, _result);
+					}
+				}
+			}
+			
+			void Nearest(const size_t& _begin, const size_t& _end, const size_t& _depth, const Point& _centre, const size_t& _count, Heap& _heap) const {
+				
+				// Maintain a max-heap of the nearest positions found so far, keyed by squared distance.
+				const auto consider = [&_centre, &_count, &_heap](const Entry& _entry) {
+					
+					const auto distance = Distance(_entry.position, _centre);
+					
+					if (_heap.size() < _count) {
+						_heap.emplace_back(distance, _entry.index);
+						std::push_heap(_heap.begin(), _heap.end());
+					}
+					else if (distance < _heap.front().first) {
+						std::pop_heap(_heap.begin(), _heap.end());
+						_heap.back() = { distance, _entry.index };
+						std::push_heap(_heap.begin(), _heap.end());
+					}
+				};
+				
+				if (_end - _begin <= s_LeafSize) {
+					
+					for (auto i = _begin; i < _end; ++i) {
+						consider(m_Entries[i]);
+					}
+				}
+				else {
+					
+					const auto  median = _begin + ((_end - _begin) / 2U);
+					const auto& split  = m_Entries[median];
+					
+					const auto offset = _centre[_depth % 3U] - split.position[_depth % 3U];
+					
+					// Search the side of the split containing the centre first, so the other side can usually be skipped.
+					if (offset <= 0.0) {
+						Nearest(_begin, median, _depth + 1U, _centre, _count, _heap);
+					}
+					else {
+						Nearest(median + 1U, _end, _depth + 1U, _centre, _count, _heap);
+					}
+					
+					consider(split);
+					
+					if (_heap.size() < _count || offset * offset < _heap.front().first) {
+						
+						if (offset <= 0.0) {
+							Nearest(median + 1U, _end, _depth + 1U, _centre, _count, _heap);
+						}
+						else {
+							Nearest(_begin, median, _depth + 1U, _centre, _count, _heap);
+						}
+					}
+				}
+			}
+			
+		public:
+			
+			KDTree() noexcept :
+				m_Entries() {}
+			
+			/**
+			 * @brief Builds a tree over the positions of a vector of stars.
+			 * @param[in] _stars The stars.
+			 * @param[in] _threads (optional) The number of threads used to build the tree, or 0 to use every hardware thread. Defaults to 1.
+			 */
+			explicit KDTree(const std::vector<T>& _stars, const size_t& _threads = 1U) :
+				m_Entries()
+			{
+				m_Entries.reserve(_stars.size());
+				
+				for (size_t i = 0U; i < _stars.size(); ++i) {
+					
+					const auto& star = _stars[i];
+					
+					if (star.x0.has_value() && star.y0.has_value() && star.z0.has_value()) {
+						m_Entries.push_back({ { *star.x0, *star.y0, *star.z0 }, i });
+					}
+				}
+				
+				Build(_threads);
+			}
+			
+			/**
+			 * @brief Builds a tree over the positions of a catalogue.
+			 * @param[in] _catalogue The catalogue.
+			 * @param[in] _threads (optional) The number of threads used to build the tree, or 0 to use every hardware thread. Defaults to 1.
+			 * @throw std::runtime_error If the positions were excluded from the catalogue by a projection.
+			 */
+			explicit KDTree(const Catalogue<T>& _catalogue, const size_t& _threads = 1U) :
+				m_Entries()
+			{
+				using F = typename T::Field;
+				
+				if (!_catalogue.Has(F::x0) || !_catalogue.Has(F::y0) || !_catalogue.Has(F::z0)) {
+					throw std::runtime_error("Catalogue does not contain the positions of its stars!");
+				}
+				
+				const auto& x0 = _catalogue.template Get<F::x0>();
+				const auto& y0 = _catalogue.template Get<F::y0>();
+				const auto& z0 = _catalogue.template Get<F::z0>();
+				
+				m_Entries.reserve(_catalogue.Size());
+				
+				for (size_t i = 0U; i < _catalogue.Size(); ++i) {
+					
+					if (x0.HasValue(i) && y0.HasValue(i) && z0.HasValue(i)) {
+						m_Entries.push_back({ { x0[i], y0[i], z0[i] }, i });
+					}
+				}
+				
+				Build(_threads);
+			}
+			
+			/**
+			 * @brief Finds every star within a distance of a point.
+			 * @param[in] _centre The point.
+			 * @param[in] _radius The distance, in parsecs.
+			 * @param[out] _result The vector to overwrite with the indices of the stars, in no particular order. Its capacity is reused.
+			 */
+			void Radius(const Point& _centre, const double& _radius, std::vector<size_t>& _result) const {
+				
+				_result.clear();
+				
+				if (!m_Entries.empty() && _radius >= 0.0) {
+					
+					const auto push = [&_result](const Entry& _entry) { _result.push_back(_entry.index); };
+					
+					Radius(0U, m_Entries.size(), 0U, _centre, _radius, _radius * _radius, push);
+				}
+			}
+			
+			/**
+			 * @brief Finds every star within a distance of a point.
+			 * @param[in] _centre The point.
+			 * @param[in] _radius The distance, in parsecs.
+			 * @return The indices of the stars, in no particular order.
+			 */
+			[[nodiscard]] std::vector<size_t> Radius(const Point& _centre, const double& _radius) const {
+				
+				std::vector<size_t> result;
+				Radius(_centre, _radius, result);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Finds the stars nearest to a point, without allocating once the buffers are large enough.
+			 *
+			 * @code
+			 * std::vector<size_t> nearest;
+			 * ATHYG::KDTree<ATHYG::V3>::Heap heap;
+			 *
+			 * for (const auto& point : points) {
+			 *     tree.Nearest(point, 10U, nearest, heap);
+			 * }
+			 * @endcode
+			 *
+			 * @param[in] _centre The point.
+			 * @param[in] _count The number of stars to find.
+			 * @param[out] _result The vector to overwrite with the indices of at most _count stars, nearest first. Its capacity is reused.
+			 * @param[in,out] _heap The buffer used to hold the candidates during the search. Its contents are overwritten, and its capacity is reused.
+			 */
+			void Nearest(const Point& _centre, const size_t& _count, std::vector<size_t>& _result, Heap& _heap) const {
+				
+				_result.clear();
+				_heap.clear();
+				
+				if (!m_Entries.empty() && _count != 0U) {
+					
+					_heap.reserve(std::min(_count, m_Entries.size()));
+					
+					Nearest(0U, m_Entries.size(), 0U, _centre, _count, _heap);
+					
+					std::sort_heap(_heap.begin(), _heap.end());
+					
+					_result.reserve(_heap.size());
+					
+					for (const auto& item : _heap) {
+						_result.push_back(item.second);
+					}
+				}
+			}
+			
+			/**
+			 * @brief Finds the stars nearest to a point.
+			 * @param[in] _centre The point.
+			 * @param[in] _count The number of stars to find.
+			 * @param[out] _result The vector to overwrite with the indices of at most _count stars, nearest first. Its capacity is reused.
+			 *
+			 * @note Allocates the candidates of the search on every call. Queries made in a loop should reuse a Heap instead.
+			 */
+			void Nearest(const Point& _centre, const size_t& _count, std::vector<size_t>& _result) const {
+				
+				Heap heap;
+				Nearest(_centre, _count, _result, heap);
+			}
+			
+			/**
+			 * @brief Finds the stars nearest to a point.
+			 * @param[in] _centre The point.
+			 * @param[in] _count The number of stars to find.
+			 * @return The indices of at most _count stars, nearest first.
+			 */
+			[[nodiscard]] std::vector<size_t> Nearest(const Point& _centre, const size_t& _count) const {
+				
+				std::vector<size_t> result;
+				Nearest(_centre, _count, result);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Finds every star within an axis-aligned bounding box.
+			 * @param[in] _min The corner of the box with the lowest coordinates.
+			 * @param[in] _max The corner of the box with the highest coordinates.
+			 * @param[out] _result The vector to overwrite with the indices of the stars, in no particular order. Its capacity is reused.
+			 *
+			 * @note Stars on the faces of the box are included.
+			 */
+			void Within(const Point& _min, const Point& _max, std::vector<size_t>& _result) const {
+				
+				_result.clear();
+				
+				if (!m_Entries.empty()) {
+					Within(0U, m_Entries.size(), 0U, _min, _max, _result);
+				}
+			}
+			
+			/**
+			 * @brief Finds every star within an axis-aligned bounding box.
+			 * @param[in] _min The corner of the box with the lowest coordinates.
+			 * @param[in] _max The corner of the box with the highest coordinates.
+			 * @return The indices of the stars, in no particular order.
+			 */
+			[[nodiscard]] std::vector<size_t> Within(const Point& _min, const Point& _max) const {
+				
+				std::vector<size_t> result;
+				Within(_min, _max, result);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the tree.
+			 * @return The number of stars with a position.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Entries.size();
+			}
+			
+			/**
+			 * @brief Returns whether the tree contains no stars.
+			 * @return True if no star has a position, false otherwise.
+			 */
+			[[nodiscard]] bool Empty() const noexcept {
+				return m_Entries.empty();
+			}
+		};
+		
+		/**
+		 * @class SkyGrid
+		 * @brief A spatial index over the equatorial coordinates (ra, dec) of the stars of a container.
+		 *
+		 * The celestial sphere is divided into rings of equal declination span, and each ring into cells of equal right ascension span,
+		 * with the number of cells of each ring proportional to its circumference, so every cell has approximately the same area.
+		 * Stars are stored contiguously in cell order, and in order of increasing magnitude within each cell, so a query visits only
+		 * the cells which intersect it, and stops reading each cell at the first star fainter than its magnitude limit.
+		 *
+		 * Queries return the indices of stars within the container the grid was built from, so the grid remains valid for as long as the container is unchanged.
+		 *
+		 * @code
+		 * const auto stars = ATHYG::Load<ATHYG::V3>(paths);
+		 *
+		 * const ATHYG::SkyGrid<ATHYG::V3> grid(stars);
+		 *
+		 * // Naked-eye stars within 30 degrees of Polaris.
+		 * const auto visible = grid.Cone(2.53, 89.26, 30.0, 6.5);
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @note As in the ATHYG files, right ascension is given in hours, and declination in degrees. Stars without both are not indexed.
+		 * @note Stars without a magnitude are treated as infinitely faint.
+		 */
+		template <typename T>
+		class SkyGrid final {
+			
+			struct Entry final {
+				
+				/** @brief The unit vector towards the star. */
+				std::array<double, 3U> direction;
+				
+				double ra;
+				double dec;
+				double magnitude;
+				size_t index;
+			};
+			
+			/** @brief The declination span of each ring, in degrees. */
+			double m_Span;
+			
+			/** @brief The index of the first cell of each ring, followed by the total number of cells. */
+			std::vector<size_t> m_Rings;
+			
+			/** @brief The index of the first entry of each cell, followed by the total number of entries. */
+			std::vector<size_t> m_Offsets;
+			
+			std::vector<Entry> m_Entries;
+			
+			[[nodiscard]] static constexpr double Radians(const double& _degrees) noexcept {
+				return _degrees * (s_Pi / 180.0);
+			}
+			
+			[[nodiscard]] static std::array<double, 3U> Direction(const double& _ra, const double& _dec) noexcept {
+				
+				const auto ra  = _ra * (s_Pi / 12.0);
+				const auto dec = Radians(_dec);
+				
+				return { std::cos(dec) * std::cos(ra), std::cos(dec) * std::sin(ra), std::sin(dec) };
+			}
+			
+			[[nodiscard]] size_t Ring(const double& _dec) const noexcept {
+				
+				const auto rings = m_Rings.size() - 1U;
+				const auto ring  = std::floor((_dec + 90.0) / m_Span);
+				
+				return ring <= 0.0 ?
+					0U :
+					std::min(static_cast<size_t>(ring), rings - 1U);
+			}
+			
+			/**
+			 * @brief Returns the cell of a ring containing a right ascension, as an unwrapped column which may lie outside of the ring.
+			 */
+			[[nodiscard]] std::ptrdiff_t Column(const size_t& _ring, const double& _ra) const noexcept {
+				
+				const auto cells = m_Rings[_ring + 1U] - m_Rings[_ring];
+				
+				return static_cast<std::ptrdiff_t>(std::floor((_ra / 24.0) * static_cast<double>(cells)));
+			}
+			
+			/**
+			 * @brief Divides the sphere into cells, then sorts the entries by cell, and by magnitude within each cell.
+			 * @param[in] _resolution The approximate width of each cell, in degrees.
+			 */
+			void Build(const double& _resolution) {
+				
+				if (!(_resolution > 0.0) || _resolution > 180.0) {
+					throw std::runtime_error("Resolution of sky grid must be greater than 0 and at most 180 degrees!");
+				}
+				
+				const auto rings = static_cast<size_t>(std::ceil(180.0 / _resolution));
+				
+				m_Span = 180.0 / static_cast<double>(rings);
+				
+				m_Rings.resize(rings + 1U);
+				m_Rings[0U] = 0U;
+				
+				for (size_t i = 0U; i < rings; ++i) {
+					
+					const auto centre = -90.0 + ((static_cast<double>(i) + 0.5) * m_Span);
+					const auto cells  = std::max(std::round((360.0 * std::cos(Radians(centre))) / m_Span), 1.0);
+					
+					m_Rings[i + 1U] = m_Rings[i] + static_cast<size_t>(cells);
+				}
+				
+				const auto cell = [this](const Entry& _entry) {
+					
+					const auto ring  = Ring(_entry.dec);
+					const auto cells = static_cast<std::ptrdiff_t>(m_Rings[ring + 1U] - m_Rings[ring]);
+					
+					return m_Rings[ring] + static_cast<size_t>(std::clamp(Column(ring, _entry.ra), static_cast<std::ptrdiff_t>(0), cells - 1));
+				};
+				
+				// Counting sort of the entries by cell.
+				std::vector<size_t> cells(m_Entries.size());
+				
+				m_Offsets.assign(m_Rings.back() + 1U, 0U);
+				
+				for (size_t i = 0U; i < m_Entries.size(); ++i) {
+					cells[i] = cell(m_Entries[i]);
+					++m_Offsets[cells[i] + 1U];
+				}
+				
+				for (size_t i = 1U; i < m_Offsets.size(); ++i) {
+					m_Offsets[i] += m_Offsets[i - 1U];
+				}
+				
+				std::vector<Entry> sorted(m_Entries.size());
+				std::vector<size_t> next(m_Offsets.begin(), m_Offsets.end() - 1);
+				
+				for (size_t i = 0U; i < m_Entries.size(); ++i) {
+					sorted[next[cells[i]]++] = m_Entries[i];
+				}
+				
+				m_Entries = std::move(sorted);
+				
+				for (size_t i = 0U; i + 1U < m_Offsets.size(); ++i) {
+					
+					std::stable_sort(m_Entries.begin() + static_cast<std::ptrdiff_t>(m_Offsets[i]),
+					                 m_Entries.begin() + static_cast<std::ptrdiff_t>(m_Offsets[i + 1U]),
+					                 [](const Entry& _a, const Entry& _b) noexcept { return _a.magnitude < _b.magnitude; });
+				}
+			}
+			
+			/**
+			 * @brief Invokes a function with every entry no fainter than a magnitude, in the cells of a ring spanning a range of right ascension.
+			 * @param[in] _from The lowest right ascension of the range, in hours.
+			 * @param[in] _to The highest right ascension of the range, in hours. May exceed 24 hours to wrap around the ring.
+			 */
+			template <typename F>
+			void Scan(const size_t& _ring, const double& _from, const double& _to, const double& _magnitude, F&& _func) const {
+				
+				const auto cells = static_cast<std::ptrdiff_t>(m_Rings[_ring + 1U] - m_Rings[_ring]);
+				
+				auto first = Column(_ring, _from);
+				auto last  = Column(_ring, _to);
+				
+				if (last - first + 1 >= cells) {
+					first = 0;
+					last  = cells - 1;
+				}
+				
+				for (auto column = first; column <= last; ++column) {
+					
+					const auto cell = m_Rings[_ring] + static_cast<size_t>(((column % cells) + cells) % cells);
+					
+					for (auto i = m_Offsets[cell]; i < m_Offsets[cell + 1U] && m_Entries[i].magnitude <= _magnitude; ++i) {
+						_func(m_Entries[i]);
+					}
+				}
+			}
+			
+		public:
+			
+			SkyGrid() noexcept :
+				m_Span(180.0),
+				m_Rings({ 0U, 1U }),
+				m_Offsets({ 0U, 0U }),
+				m_Entries() {}
+			
+			/**
+			 * @brief Builds a grid over the coordinates of a vector of stars.
+			 * @param[in] _stars The stars.
+			 * @param[in] _resolution (optional) The approximate width of each cell, in degrees. Defaults to 1 degree.
+			 * @throw std::runtime_error If the resolution is not within (0, 180] degrees.
+			 */
+			explicit SkyGrid(const std::vector<T>& _stars, const double& _resolution = 1.0) :
+				m_Span(),
+				m_Rings(),
+				m_Offsets(),
+				m_Entries()
+			{
+				m_Entries.reserve(_stars.size());
+				
+				for (size_t i = 0U; i < _stars.size(); ++i) {
+					
+					const auto& star = _stars[i];
+					
+					if (star.ra.has_value() && star.dec.has_value()) {
+						
+						m_Entries.push_back({
+							Direction(*star.ra, *star.dec),
+							*star.ra,
+							*star.dec,
+							star.mag.value_or(std::numeric_limits<double>::infinity()),
+							i
+						});
+					}
+				}
+				
+				Build(_resolution);
+			}
+			
+			/**
+			 * @brief Builds a grid over the coordinates of a catalogue.
+			 * @param[in] _catalogue The catalogue.
+			 * @param[in] _resolution (optional) The approximate width of each cell, in degrees. Defaults to 1 degree.
+			 * @throw std::runtime_error If the coordinates were excluded from the catalogue by a projection.
+			 * @throw std::runtime_error If the resolution is not within (0, 180] degrees.
+			 */
+			explicit SkyGrid(const Catalogue<T>& _catalogue, const double& _resolution = 1.0) :
+				m_Span(),
+				m_Rings(),
+				m_Offsets(),
+				m_Entries()
+			{
+				using F = typename T::Field;
+				
+				if (!_catalogue.Has(F::ra) || !_catalogue.Has(F::dec)) {
+					throw std::runtime_error("Catalogue does not contain the coordinates of its stars!");
+				}
+				
+				const auto& ra  = _catalogue.template Get<F::ra>();
+				const auto& dec = _catalogue.template Get<F::dec>();
+				const auto& mag = _catalogue.template Get<F::mag>();
+				
+				const bool magnitudes = _catalogue.Has(F::mag);
+				
+				m_Entries.reserve(_catalogue.Size());
+				
+				for (size_t i = 0U; i < _catalogue.Size(); ++i) {
+					
+					if (ra.HasValue(i) && dec.HasValue(i)) {
+						
+						m_Entries.push_back({
+							Direction(ra[i], dec[i]),
+							ra[i],
+							dec[i],
+							magnitudes && mag.HasValue(i) ? mag[i] : std::numeric_limits<double>::infinity(),
+							i
+						});
+					}
+				}
+				
+				Build(_resolution);
+			}
+			
+			/**
+			 * @brief Finds every star within an angular distance of a point on the celestial sphere.
+			 * @param[in] _ra The right ascension of the point, in hours.
+			 * @param[in] _dec The declination of the point, in degrees.
+			 * @param[in] _radius The angular distance, in degrees.
+			 * @param[out] _result The vector to overwrite with the indices of the stars, ordered by cell, then by magnitude. Its capacity is reused.
+			 * @param[in] _magnitude (optional) The faintest magnitude to include. Defaults to including every star.
+			 */
+			void Cone(const double& _ra, const double& _dec, const double& _radius, std::vector<size_t>& _result, const double& _magnitude = std::numeric_limits<double>::infinity()) const {
+				
+				_result.clear();
+				
+				if (m_Entries.empty() || _radius < 0.0) {
+					return;
+				}
+				
+				const auto centre  = Direction(_ra, _dec);
+				const auto minimum = std::cos(Radians(std::min(_radius, 180.0)));
+				
+				// The right ascension spanned by the cone, unless it contains a pole.
+				auto span = 12.0;
+				
+				if (_dec + _radius < 90.0 && _dec - _radius > -90.0) {
+					
+					const auto ratio = std::sin(Radians(_radius)) / std::cos(Radians(_dec));
+					
+					if (ratio < 1.0) {
+						span = std::asin(ratio) * (12.0 / s_Pi);
+					}
+				}
+				
+				const auto push = [&_result, &centre, &minimum](const Entry& _entry) {
+					
+					const auto& direction = _entry.direction;
+					
+					if ((direction[0U] * centre[0U]) + (direction[1U] * centre[1U]) + (direction[2U] * centre[2U]) >= minimum) {
+						_result.push_back(_entry.index);
+					}
+				};
+				
+				const auto first = Ring(_dec - _radius);
+				const auto last  = Ring(_dec + _radius);
+				
+				for (auto ring = first; ring <= last; ++ring) {
+					Scan(ring, _ra - span, _ra + span, _magnitude, push);
+				}
+			}
+			
+			/**
+			 * @brief Finds every star within an angular distance of a point on the celestial sphere.
+			 * @param[in] _ra The right ascension of the point, in hours.
+			 * @param[in] _dec The declination of the point, in degrees.
+			 * @param[in] _radius The angular distance, in degrees.
+			 * @param[in] _magnitude (optional) The faintest magnitude to include. Defaults to including every star.
+			 * @return The indices of the stars, ordered by cell, then by magnitude.
+			 */
+			[[nodiscard]] std::vector<size_t> Cone(const double& _ra, const double& _dec, const double& _radius, const double& _magnitude = std::numeric_limits<double>::infinity()) const {
+				
+				std::vector<size_t> result;
+				Cone(_ra, _dec, _radius, result, _magnitude);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Finds every star within a range of right ascension and declination, such as the field of view of a telescope.
+			 * @param[in] _ra_min The lowest right ascension of the range, in hours.
+			 * @param[in] _ra_max The highest right ascension of the range, in hours. If less than _ra_min, the range wraps through 0 hours.
+			 * @param[in] _dec_min The lowest declination of the range, in degrees.
+			 * @param[in] _dec_max The highest declination of the range, in degrees.
+			 * @param[out] _result The vector to overwrite with the indices of the stars, ordered by cell, then by magnitude. Its capacity is reused.
+			 * @param[in] _magnitude (optional) The faintest magnitude to include. Defaults to including every star.
+			 *
+			 * @note Stars on the boundary of the range are included.
+			 */
+			void Rectangle(const double& _ra_min, const double& _ra_max, const double& _dec_min, const double& _dec_max, std::vector<size_t>& _result, const double& _magnitude = std::numeric_limits<double>::infinity()) const {
+				
+				_result.clear();
+				
+				if (m_Entries.empty() || _dec_min > _dec_max) {
+					return;
+				}
+				
+				const bool wraps = _ra_min > _ra_max;
+				
+				const auto push = [&](const Entry& _entry) {
+					
+					const bool ra = wraps ?
+						_entry.ra >= _ra_min || _entry.ra <= _ra_max :
+						_entry.ra >= _ra_min && _entry.ra <= _ra_max;
+					
+					if (ra && _entry.dec >= _dec_min && _entry.dec <= _dec_max) {
+						_result.push_back(_entry.index);
+					}
+				};
+				
+				const auto first = Ring(_dec_min);
+				const auto last  = Ring(_dec_max);
+				
+				for (auto ring = first; ring <= last; ++ring) {
+					Scan(ring, _ra_min, wraps ? _ra_max + 24.0 : _ra_max, _magnitude, push);
+				}
+			}
+			
+			/**
+			 * @brief Finds every star within a range of right ascension and declination, such as the field of view of a telescope.
+			 * @param[in] _ra_min The lowest right ascension of the range, in hours.
+			 * @param[in] _ra_max The highest right ascension of the range, in hours. If less than _ra_min, the range wraps through 0 hours.
+			 * @param[in] _dec_min The lowest declination of the range, in degrees.
+			 * @param[in] _dec_max The highest declination of the range, in degrees.
+			 * @param[in] _magnitude (optional) The faintest magnitude to include. Defaults to including every star.
+			 * @return The indices of the stars, ordered by cell, then by magnitude.
+			 *
+			 * @note Stars on the boundary of the range are included.
+			 */
+			[[nodiscard]] std::vector<size_t> Rectangle(const double& _ra_min, const double& _ra_max, const double& _dec_min, const double& _dec_max, const double& _magnitude = std::numeric_limits<double>::infinity()) const {
+				
+				std::vector<size_t> result;
+				Rectangle(_ra_min, _ra_max, _dec_min, _dec_max, result, _magnitude);
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the grid.
+			 * @return The number of stars with coordinates.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Entries.size();
+			}
+			
+			/**
+			 * @brief Returns whether the grid contains no stars.
+			 * @return True if no star has coordinates, false otherwise.
+			 */
+			[[nodiscard]] bool Empty() const noexcept {
+				return m_Entries.empty();
+			}
+		};
+		
+		/**
+		 * @class IdentifierIndex
+		 * @brief Hash indexes over the catalogue identifiers (hip, hd, hr, gaia, and tyc) of the stars of a container.
+		 *
+		 * Each identifier is indexed by an open-addressing hash table with linear probing, which is built the first time the identifier is looked up,
+		 * so identifiers which are never looked up cost nothing. Tables are built at most once, even if looked up concurrently from multiple threads.
+		 *
+		 * Batched lookups hash every identifier in one pass, then probe the table while prefetching the slots of later identifiers,
+		 * so the latency of cache misses overlaps rather than accumulating for each identifier.
+		 *
+		 * Lookups return the indices of stars within the container the index was built from, which must outlive the index and remain unchanged.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 *
+		 * const auto stars = ATHYG::Load<ATHYG::V3>(paths);
+		 *
+		 * const ATHYG::IdentifierIndex<ATHYG::V3> index(stars);
+		 *
+		 * // Sirius.
+		 * if (const auto sirius = index.Find<F::hip>(32349U)) {
+		 *     std::cout << *stars[*sirius].proper << '\n';
+		 * }
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @note If multiple stars share an identifier, the first of them is returned.
+		 */
+		template <typename T>
+		class IdentifierIndex final {
+			
+			/** @brief Grants the unit tests (see benchmark/Tests.cpp) access to the tables, to simulate collisions of hashes. */
+			friend struct ATHYGTests;
+			
+			using F = typename T::Field;
+			
+		public:
+			
+			/** @brief The index returned by a batched lookup for an identifier which is not found. */
+			static constexpr size_t s_NotFound { std::numeric_limits<size_t>::max() };
+			
+			/**
+			 * @brief The type of an identifier. Tycho-2 identifiers are text, and every other identifier is an integer.
+			 * @tparam _Field The field holding the identifier.
+			 */
+			template <F _Field>
+			using Key = std::conditional_t<_Field == F::tyc, std::string_view, size_t>;
+			
+		private:
+			
+			/** @brief The number of identifiers ahead of the current identifier whose slots are prefetched by a batched lookup. */
+			static constexpr size_t s_Prefetch { 8U };
+			
+			struct Slot final {
+				
+				/** @brief The identifier if it is an integer, or the hash of the identifier otherwise. */
+				uint64_t key;
+				
+				/** @brief The index of the star, or s_NotFound if the slot is empty. */
+				size_t index;
+			};
+			
+			struct Table final {
+				
+				std::once_flag    once;
+				std::vector<Slot> slots;
+			};
+			
+			const std::vector<T>* m_Stars;
+			const Catalogue<T>*   m_Catalogue;
+			
+			mutable std::array<Table, 5U> m_Tables;
+			
+			/** @brief Returns the table of an identifier. */
+			template <F _Field>
+			[[nodiscard]] static constexpr size_t Position() noexcept {
+				
+				static_assert(_Field == F::hip || _Field == F::hd || _Field == F::hr || _Field == F::gaia || _Field == F::tyc,
+				        "Field must be a catalogue identifier!");
+				
+				if constexpr (_Field == F::hip) {
+					return 0U;
+				}
+				else if constexpr (_Field == F::hd) {
+					return 1U;
+				}
+				else if constexpr (_Field == F::hr) {
+					return 2U;
+				}
+				else if constexpr (_Field == F::gaia) {
+					return 3U;
+				}
+				else {
+					return 4U;
+				}
+			}
+			
+			static void Prefetch(const void* _address) noexcept {
+				
+			#if defined(__GNUC__) || defined(__clang__)
+				__builtin_prefetch(_address);
+			#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+				_mm_prefetch(static_cast<const char*>(_address), _MM_HINT_T0);
+			#else
+				static_cast<void>(_address);
+			#endif
+			}
+			
+			/**
+			 * @brief Returns the key of an identifier within a table.
+			 */
+			template <F _Field>
+			[[nodiscard]] static uint64_t Hash(const Key<_Field>& _id) noexcept {
+				
+				if constexpr (std::is_same_v<Key<_Field>, std::string_view>) {
+					return ATHYG::Hash(_id);
+				}
+				else {
+					return static_cast<uint64_t>(_id);
+				}
+			}
+			
+			/**
+			 * @brief Returns the first slot to probe for a key, scrambling its bits so that sequential identifiers are spread across the table.
+			 */
+			[[nodiscard]] static constexpr size_t Bucket(uint64_t _key, const size_t& _mask) noexcept {
+				
+				_key ^= _key >> 33U;
+				_key *= 0xFF51AFD7ED558CCDULL;
+				_key ^= _key >> 33U;
+				
+				return static_cast<size_t>(_key) & _mask;
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the container.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Stars != nullptr ? m_Stars->size() : m_Catalogue->Size();
+			}
+			
+			/**
+			 * @brief Returns the identifier of a star in the container.
+			 */
+			template <F _Field>
+			[[nodiscard]] std::optional<Key<_Field>> Value(const size_t& _index) const noexcept {
+				
+				if (m_Catalogue != nullptr) {
+					
+					const auto value = m_Catalogue->template Get<_Field>().Get(_index);
+					
+					return value.has_value() ?
+						std::optional<Key<_Field>>(static_cast<Key<_Field>>(*value)) :
+						std::nullopt;
+				}
+				
+				const auto& star = (*m_Stars)[_index];
+				
+				const auto& value = [&star]() noexcept -> const auto& {
+					
+					if constexpr (_Field == F::hip) {
+						return star.hip;
+					}
+					else if constexpr (_Field == F::hd) {
+						return star.hd;
+					}
+					else if constexpr (_Field == F::hr) {
+						return star.hr;
+					}
+					else if constexpr (_Field == F::gaia) {
+						return star.gaia;
+					}
+					else {
+						return star.tyc;
+					}
+				}();
+				
+				// Empty text is a missing identifier, consistent with the text columns of a catalogue.
+				if constexpr (std::is_same_v<Key<_Field>, std::string_view>) {
+					
+					if (value.has_value() && value->empty()) {
+						return std::nullopt;
+					}
+				}
+				
+				return value.has_value() ?
+					std::optional<Key<_Field>>(static_cast<Key<_Field>>(*value)) :
+					std::nullopt;
+			}
+			
+			/**
+			 * @brief Returns whether a slot holds an identifier.
+			 */
+			template <F _Field>
+			[[nodiscard]] bool Matches(const Slot& _slot, const uint64_t& _key, const Key<_Field>& _id) const noexcept {
+				
+				if constexpr (std::is_same_v<Key<_Field>, std::string_view>) {
+					return _slot.key == _key && Value<_Field>(_slot.index) == _id;
+				}
+				else {
+					static_cast<void>(_id);
+					return _slot.key == _key;
+				}
+			}
+			
+			/**
+			 * @brief Returns the table of an identifier, building it if it has not been built.
+			 * @throw std::runtime_error If the identifier was excluded from the catalogue by a projection.
+			 */
+			template <F _Field>
+			const std::vector<Slot>& Build() const {
+				
+				auto& table = m_Tables[Position<_Field>()];
+				
+				std::call_once(table.once, [this, &table]() {
+					
+					if (m_Catalogue != nullptr && !m_Catalogue->Has(_Field)) {
+						throw std::runtime_error("Catalogue does not contain the identifier \"" + std::string(T::s_Names[static_cast<size_t>(_Field)]) + "\"!");
+					}
+					
+					// Size the table to at most half full, so probe sequences stay short.
+					size_t capacity = 16U;
+					
+					while (capacity < Size() * 2U) {
+						capacity *= 2U;
+					}
+					
+					std::vector<Slot> slots(capacity, Slot { 0U, s_NotFound });
+					
+					const auto mask = capacity - 1U;
+					
+					for (size_t i = 0U; i < Size(); ++i) {
+						
+						if (const auto id = Value<_Field>(i)) {
+							
+							const auto key = Hash<_Field>(*id);
+							
+							auto bucket = Bucket(key, mask);
+							
+							while (slots[bucket].index != s_NotFound && !Matches<_Field>(slots[bucket], key, *id)) {
+								bucket = (bucket + 1U) & mask;
+							}
+							
+							// Keep the first star with the identifier.
+							if (slots[bucket].index == s_NotFound) {
+								slots[bucket] = { key, i };
+							}
+						}
+					}
+					
+					table.slots = std::move(slots);
+				});
+				
+				return table.slots;
+			}
+			
+			template <F _Field>
+			[[nodiscard]] size_t Probe(const std::vector<Slot>& _slots, const uint64_t& _key, const Key<_Field>& _id) const noexcept {
+				
+				const auto mask = _slots.size() - 1U;
+				
+				for (auto bucket = Bucket(_key, mask);; bucket = (bucket + 1U) & mask) {
+					
+					const auto& slot = _slots[bucket];
+					
+					if (slot.index == s_NotFound || Matches<_Field>(slot, _key, _id)) {
+						return slot.index;
+					}
+				}
+			}
+			
+		public:
+			
+			/**
+			 * @brief Creates an index over the identifiers of a vector of stars.
+			 * @param[in] _stars The stars. Must outlive the index.
+			 */
+			explicit IdentifierIndex(const std::vector<T>& _stars) noexcept :
+				m_Stars(&_stars),
+				m_Catalogue(nullptr),
+				m_Tables() {}
+			
+			/**
+			 * @brief Creates an index over the identifiers of a catalogue.
+			 * @param[in] _catalogue The catalogue. Must outlive the index.
+			 */
+			explicit IdentifierIndex(const Catalogue<T>& _catalogue) noexcept :
+				m_Stars(nullptr),
+				m_Catalogue(&_catalogue),
+				m_Tables() {}
+			
+			/**
+			 * @brief Finds the star with an identifier.
+			 * @tparam _Field The field holding the identifier. Must be F::hip, F::hd, F::hr, F::gaia, or F::tyc.
+			 * @param[in] _id The identifier.
+			 * @return The index of the star, or std::nullopt if no star has the identifier.
+			 * @throw std::runtime_error If the identifier was excluded from the catalogue by a projection.
+			 */
+			template <F _Field>
+			[[nodiscard]] std::optional<size_t> Find(const Key<_Field>& _id) const {
+				
+				const auto index = Probe<_Field>(Build<_Field>(), Hash<_Field>(_id), _id);
+				
+				return index == s_NotFound ?
+					std::nullopt :
+					std::optional<size_t>(index);
+			}
+			
+			/**
+			 * @brief Finds the stars with each of a list of identifiers, such as when cross-matching an external catalogue.
+			 * @tparam _Field The field holding the identifiers. Must be F::hip, F::hd, F::hr, F::gaia, or F::tyc.
+			 * @param[in] _ids The identifiers.
+			 * @param[out] _result The vector to overwrite with the index of the star with each identifier, or s_NotFound if no star has it. Its capacity is reused.
+			 * @throw std::runtime_error If the identifier was excluded from the catalogue by a projection.
+			 */
+			template <F _Field>
+			void Find(const std::vector<Key<_Field>>& _ids, std::vector<size_t>& _result) const {
+				
+				const auto& slots = Build<_Field>();
+				
+				const auto mask = slots.size() - 1U;
+				
+				// Hash every identifier in one pass, so the slots of later identifiers are known in advance.
+				std::vector<uint64_t> keys(_ids.size());
+				
+				for (size_t i = 0U; i < _ids.size(); ++i) {
+					keys[i] = Hash<_Field>(_ids[i]);
+				}
+				
+				_result.resize(_ids.size());
+				
+				for (size_t i = 0U; i < _ids.size(); ++i) {
+					
+					if (i + s_Prefetch < _ids.size()) {
+						Prefetch(&slots[Bucket(keys[i + s_Prefetch], mask)]);
+					}
+					
+					_result[i] = Probe<_Field>(slots, keys[i], _ids[i]);
+				}
+			}
+			
+			/**
+			 * @brief Finds the stars with each of a list of identifiers, such as when cross-matching an external catalogue.
+			 * @tparam _Field The field holding the identifiers. Must be F::hip, F::hd, F::hr, F::gaia, or F::tyc.
+			 * @param[in] _ids The identifiers.
+			 * @return The index of the star with each identifier, or s_NotFound if no star has it.
+			 * @throw std::runtime_error If the identifier was excluded from the catalogue by a projection.
+			 */
+			template <F _Field>
+			[[nodiscard]] std::vector<size_t> Find(const std::vector<Key<_Field>>& _ids) const {
+				
+				std::vector<size_t> result;
+				Find<_Field>(_ids, result);
+				
+				return result;
+			}
+		};
+		
+		/**
+		 * @class MagnitudeOrder
+		 * @brief An ordering of the stars of a container by magnitude, brightest first, for progressive rendering.
+		 *
+		 * Magnitudes are converted to single precision and sorted by a stable, parallel least-significant-digit radix sort of their bit patterns,
+		 * in linear time. The sorted stars are also divided into buckets of equal magnitude width, so a consumer can draw the stars of the first
+		 * few buckets, then extend the set by whole buckets as frame time allows, without sorting again.
+		 *
+		 * @code
+		 * auto stars = ATHYG::Load<ATHYG::V3>(paths);
+		 *
+		 * const ATHYG::MagnitudeOrder<ATHYG::V3> order(stars, 0.5, 0U);
+		 * order.Apply(stars);
+		 *
+		 * // Every star of magnitude 6.5 or brighter is now at the start of the vector.
+		 * const auto visible = order.Count(6.5);
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 * @tparam _Field (optional) The field to order by. Either the apparent (mag) or absolute (absmag) magnitude. Defaults to the apparent magnitude.
+		 *
+		 * @note Stars without a magnitude are ordered after every other star, and do not belong to any bucket. Stars of equal magnitude keep their relative order.
+		 * @note Only vectors can be reordered by Apply. The rows of a catalogue remain in file order, which Reload, the binary cache and NUMA partitions
+		 * depend on, so a catalogue is instead read through Order(), for example by passing it to Catalogue::Export.
+		 */
+		template <typename T, typename T::Field _Field = T::Field::mag>
+		class MagnitudeOrder final {
+			
+			static_assert(_Field == T::Field::mag || _Field == T::Field::absmag, "Field must be a magnitude!");
+			
+			/** @brief The number of bits of the key sorted by each pass of the radix sort. */
+			static constexpr size_t s_Bits { 8U };
+			
+			/** @brief The minimum number of stars sorted by each thread. */
+			static constexpr size_t s_Grain { 65536U };
+			
+			/** @brief The maximum number of buckets. */
+			static constexpr size_t s_MaxBuckets { 1U << 20U };
+			
+			/** @brief The key of a star without a magnitude, which is ordered after every magnitude. */
+			static constexpr uint32_t s_None { std::numeric_limits<uint32_t>::max() };
+			
+			struct Item final {
+				
+				uint32_t key;
+				size_t   index;
+			};
+			
+			/** @brief The index of each star in the container, brightest first. */
+			std::vector<size_t> m_Order;
+			
+			/** @brief The key of each star, in order. */
+			std::vector<uint32_t> m_Keys;
+			
+			/** @brief The offset of the first star of each bucket, followed by the number of stars with a magnitude. */
+			std::vector<size_t> m_Offsets;
+			
+			double m_Base;
+			double m_Width;
+			
+			/**
+			 * @brief Maps a magnitude to an unsigned integer which compares in the same order.
+			 */
+			[[nodiscard]] static uint32_t Key(const double& _magnitude) noexcept {
+				
+				if (std::isnan(_magnitude)) {
+					return s_None;
+				}
+				
+				// Negative zero is ordered as positive zero.
+				const auto value = _magnitude == 0.0 ? 0.0F : static_cast<float>(_magnitude);
+				
+				uint32_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				
+				// Flip every bit of negative numbers, and only the sign bit of positive numbers.
+				return (bits & 0x80000000U) != 0U ?
+					~bits :
+					bits | 0x80000000U;
+			}
+			
+			/**
+			 * @brief Maps a key back to the magnitude it was created from, at single precision.
+			 */
+			[[nodiscard]] static double Magnitude(uint32_t _key) noexcept {
+				
+				_key = (_key & 0x80000000U) != 0U ?
+					_key & 0x7FFFFFFFU :
+					~_key;
+				
+				float result;
+				std::memcpy(&result, &_key, sizeof(result));
+				
+				return static_cast<double>(result);
+			}
+			
+			/**
+			 * @brief Sorts items by key, preserving the order of items with equal keys.
+			 * @param[in] _threads The number of threads to sort with.
+			 */
+			static void Sort(std::vector<Item>& _items, const size_t& _threads) {
+				
+				constexpr size_t radix = static_cast<size_t>(1U) << s_Bits;
+				
+				const auto count = _items.size();
+				const auto parts = std::max(std::min(_threads, count / s_Grain), static_cast<size_t>(1U));
+				
+				// Each thread counts and scatters a contiguous part of the items, so the sort is stable.
+				const auto range = [&count, &parts](const size_t& _part) {
+					return std::make_pair((count * _part) / parts, (count * (_part + 1U)) / parts);
+				};
+				
+				std::vector<Item> buffer(count);
+				std::vector<std::array<size_t, radix>> offsets(parts);
+				
+				for (size_t shift = 0U; shift < 32U; shift += s_Bits) {
+					
+					ParallelFor(parts, _threads, [&](const size_t& _part) {
+						
+						auto& histogram = offsets[_part];
+						histogram.fill(0U);
+						
+						const auto [begin, end] = range(_part);
+						
+						for (auto i = begin; i < end; ++i) {
+							++histogram[(_items[i].key >> shift) & (radix - 1U)];
+						}
+					});
+					
+					// Convert the counts to the offset at which each part writes each digit, skipping passes in which every key has the same digit.
+					bool uniform = false;
+					size_t total = 0U;
+					
+					for (size_t digit = 0U; digit < radix; ++digit) {
+						
+						const auto start = total;
+						
+						for (auto& histogram : offsets) {
+							
+							const auto items = histogram[digit];
+							
+							histogram[digit] = total;
+							total += items;
+						}
+						
+						uniform = uniform || (total - start == count);
+					}
+					
+					if (!uniform) {
+						
+						ParallelFor(parts, _threads, [&](const size_t& _part) {
+							
+							auto& next = offsets[_part];
+							
+							const auto [begin, end] = range(_part);
+							
+							for (auto i = begin; i < end; ++i) {
+								buffer[next[(_items[i].key >> shift) & (radix - 1U)]++] = _items[i];
+							}
+						});
+						
+						_items.swap(buffer);
+					}
+				}
+			}
+			
+			/**
+			 * @brief Sorts the keys of a container and divides them into buckets.
+			 */
+			void Build(std::vector<Item>&& _items, const double& _width, const size_t& _threads) {
+				
+				if (!(_width > 0.0)) {
+					throw std::runtime_error("Width of magnitude buckets must be greater than 0!");
+				}
+				
+				const auto threads = _threads == 0U ?
+					static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)) :
+					_threads;
+				
+				Sort(_items, threads);
+				
+				m_Order.resize(_items.size());
+				m_Keys.resize(_items.size());
+				
+				for (size_t i = 0U; i < _items.size(); ++i) {
+					m_Order[i] = _items[i].index;
+					m_Keys[i]  = _items[i].key;
+				}
+				
+				m_Width = _width;
+				
+				const auto known = static_cast<size_t>(std::lower_bound(m_Keys.begin(), m_Keys.end(), s_None) - m_Keys.begin());
+				
+				if (known == 0U) {
+					m_Base    = 0.0;
+					m_Offsets = { 0U };
+				}
+				else {
+					
+					m_Base = std::floor(Magnitude(m_Keys.front()) / m_Width) * m_Width;
+					
+					const auto buckets = std::floor((Magnitude(m_Keys[known - 1U]) - m_Base) / m_Width) + 1.0;
+					
+					if (!(buckets <= static_cast<double>(s_MaxBuckets))) {
+						throw std::runtime_error("Range of magnitudes is too large for the width of magnitude buckets!");
+					}
+					
+					m_Offsets.resize(static_cast<size_t>(buckets) + 1U);
+					m_Offsets.front() = 0U;
+					m_Offsets.back()  = known;
+					
+					for (size_t bucket = 1U; bucket + 1U < m_Offsets.size(); ++bucket) {
+						
+						const auto key = Key(m_Base + (static_cast<double>(bucket) * m_Width));
+						
+						m_Offsets[bucket] = static_cast<size_t>(std::lower_bound(m_Keys.begin() + static_cast<std::ptrdiff_t>(m_Offsets[bucket - 1U]), m_Keys.begin() + static_cast<std::ptrdiff_t>(known), key) - m_Keys.begin());
+					}
+				}
+			}
+			
+		public:
+			
+			/**
+			 * @brief Orders a vector of stars by magnitude.
+			 * @param[in] _stars The stars.
+			 * @param[in] _width (optional) The magnitude width of each bucket. Defaults to 1 magnitude.
+			 * @param[in] _threads (optional) The number of threads used to sort, or 0 to use every hardware thread. Defaults to 1.
+			 * @throw std::runtime_error If the width is not greater than 0, or would divide the magnitudes into more than 2^20 buckets.
+			 */
+			explicit MagnitudeOrder(const std::vector<T>& _stars, const double& _width = 1.0, const size_t& _threads = 1U) :
+				m_Order(),
+				m_Keys(),
+				m_Offsets(),
+				m_Base(),
+				m_Width()
+			{
+				std::vector<Item> items(_stars.size());
+				
+				for (size_t i = 0U; i < _stars.size(); ++i) {
+					
+					const auto& magnitude = _Field == T::Field::mag ?
+						_stars[i].mag :
+						_stars[i].absmag;
+					
+					items[i] = { magnitude.has_value() ? Key(*magnitude) : s_None, i };
+				}
+				
+				Build(std::move(items), _width, _threads);
+			}
+			
+			/**
+			 * @brief Orders a catalogue by magnitude.
+			 * @param[in] _catalogue The catalogue.
+			 * @param[in] _width (optional) The magnitude width of each bucket. Defaults to 1 magnitude.
+			 * @param[in] _threads (optional) The number of threads used to sort, or 0 to use every hardware thread. Defaults to 1.
+			 * @throw std::runtime_error If the magnitude was excluded from the catalogue by a projection.
+			 * @throw std::runtime_error If the width is not greater than 0, or would divide the magnitudes into more than 2^20 buckets.
+			 */
+			explicit MagnitudeOrder(const Catalogue<T>& _catalogue, const double& _width = 1.0, const size_t& _threads = 1U) :
+				m_Order(),
+				m_Keys(),
+				m_Offsets(),
+				m_Base(),
+				m_Width()
+			{
+				if (!_catalogue.Has(_Field)) {
+					throw std::runtime_error("Catalogue does not contain the magnitudes of its stars!");
+				}
+				
+				const auto& column = _catalogue.template Get<_Field>();
+				
+				std::vector<Item> items(_catalogue.Size());
+				
+				for (size_t i = 0U; i < _catalogue.Size(); ++i) {
+					items[i] = { column.HasValue(i) ? Key(column[i]) : s_None, i };
+				}
+				
+				Build(std::move(items), _width, _threads);
+			}
+			
+			/**
+			 * @brief Reorders a vector of stars by magnitude, brightest first.
+			 * @param[in,out] _stars The stars the order was created from.
+			 * @throw std::runtime_error If the number of stars differs from the number of stars the order was created from.
+			 *
+			 * @note Once applied, the indices returned by Order() no longer refer to the vector.
+			 * @note There is no equivalent for catalogues, whose rows must remain in file order (see the class description).
+			 */
+			void Apply(std::vector<T>& _stars) const {
+				
+				if (_stars.size() != m_Order.size()) {
+					throw std::runtime_error("Number of stars not consistent with magnitude order!");
+				}
+				
+				std::vector<T> result;
+				result.reserve(_stars.size());
+				
+				for (const auto& index : m_Order) {
+					result.push_back(std::move(_stars[index]));
+				}
+				
+				_stars = std::move(result);
+			}
+			
+			/**
+			 * @brief Returns the index of every star in the container, brightest first.
+			 * @return A reference to the indices.
+			 */
+			[[nodiscard]] const std::vector<size_t>& Order() const noexcept {
+				return m_Order;
+			}
+			
+			/**
+			 * @brief Returns the offset within the order at which each bucket begins.
+			 *
+			 * Bucket i holds the stars with a magnitude in [Base() + (i * Width()), Base() + ((i + 1) * Width())).
+			 * The last offset is the number of stars with a magnitude, so the number of buckets is one less than the number of offsets.
+			 *
+			 * @return A reference to the offsets.
+			 */
+			[[nodiscard]] const std::vector<size_t>& Offsets() const noexcept {
+				return m_Offsets;
+			}
+			
+			/**
+			 * @brief Returns the magnitude at which the first bucket begins, which is a multiple of the width of each bucket.
+			 * @return The magnitude.
+			 */
+			[[nodiscard]] double Base() const noexcept {
+				return m_Base;
+			}
+			
+			/**
+			 * @brief Returns the magnitude width of each bucket.
+			 * @return The width.
+			 */
+			[[nodiscard]] double Width() const noexcept {
+				return m_Width;
+			}
+			
+			/**
+			 * @brief Returns the number of stars no fainter than a magnitude, which are the first stars of the order.
+			 * @param[in] _magnitude The faintest magnitude to include.
+			 * @return The number of stars.
+			 *
+			 * @note Magnitudes are compared at single precision.
+			 */
+			[[nodiscard]] size_t Count(const double& _magnitude) const noexcept {
+				
+				const auto key = Key(_magnitude);
+				
+				return key == s_None ?
+					0U :
+					static_cast<size_t>(std::upper_bound(m_Keys.begin(), std::lower_bound(m_Keys.begin(), m_Keys.end(), s_None), key) - m_Keys.begin());
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the order.
+			 * @return The number of stars in the container, including those without a magnitude.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Order.size();
+			}
+		};
+		
+		/**
+		 * @class LazyCatalogue
+		 * @brief The rows of ATHYG dataset files, held as raw bytes and parsed field by field when they are accessed.
+		 *
+		 * Opening the files only locates their rows, so a star costs nothing to parse until one of its fields is read, and only that field is parsed.
+		 * Suited to inspecting a few fields of a few stars of a large catalogue, for which constructing every record or column would be wasteful.
+		 *
+		 * Uncompressed files opened with Source::Mapped are mapped, so only the pages of the stars which are read need ever be loaded from disk.
+		 * Other files are read into memory in full, and compressed files are decompressed.
+		 *
+		 * Optionally, the offset of every field of every row can be recorded while the rows are located, so that a field can be found without tokenising its row.
+		 *
+		 * @code
+		 * using F = ATHYG::V3::Field;
+		 *
+		 * ATHYG::Options options;
+		 * options.source = ATHYG::Source::Mapped;
+		 *
+		 * const auto stars = ATHYG::LazyCatalogue<ATHYG::V3>::Open(paths, options);
+		 *
+		 * const auto star = stars[123456U];
+		 *
+		 * const auto proper = star.template Get<F::proper>(); // std::optional<std::string>
+		 * const auto mag    = star.template Get<F::mag>();    // std::optional<double>
+		 * @endcode
+		 *
+		 * @tparam T The ATHYG dataset version (V1, V2, or V3).
+		 *
+		 * @note Fields are parsed each time they are accessed, and are not cached, so that each Record remains a few pointers in size.
+		 */
+		template <typename T>
+		class LazyCatalogue final {
+			
+			static_assert(IsVersion<T>::value, "Template argument must be an ATHYG version!");
+			
+		public:
+			
+			/**
+			 * @struct Span
+			 * @brief The location of a field within its row.
+			 */
+			struct Span final {
+				
+				/** @brief The offset of the field from the start of its row, or s_None if the file has no column for the field. */
+				uint16_t offset;
+				
+				/** @brief The length of the field, in bytes. */
+				uint16_t size;
+			};
+			
+			/** @brief The offset of a field which is not present in its file. */
+			static constexpr uint16_t s_None { std::numeric_limits<uint16_t>::max() };
+			
+			/** @brief The type of the value of a field. */
+			template <typename T::Field F>
+			using ValueOf = typename std::tuple_element_t<static_cast<size_t>(F), std::remove_const_t<decltype(T::s_Schema)>>::Value;
+			
+			/**
+			 * @class Record
+			 * @brief A view of the row of a star, which parses its fields on access.
+			 *
+			 * Records reference the rows held by the catalogue, so must not outlive it.
+			 */
+			class Record final {
+				
+				friend LazyCatalogue;
+				
+				std::string_view m_Row;
+				
+				const Layout<T>* m_Layout;
+				const Span*      m_Spans;
+				
+				Record(const std::string_view& _row, const Layout<T>* const _layout, const Span* const _spans) noexcept :
+					m_Row(_row),
+					m_Layout(_layout),
+					m_Spans(_spans) {}
+				
+			public:
+				
+				/**
+				 * @brief Returns the unparsed bytes of the row, excluding its newline.
+				 * @return A view of the row.
+				 */
+				[[nodiscard]] std::string_view Row() const noexcept {
+					return m_Row;
+				}
+				
+				/**
+				 * @brief Returns the unparsed bytes of a field.
+				 *
+				 * Without an offset table, the row is scanned up to the column of the field, honouring double-quoted fields as Load does.
+				 *
+				 * @param[in] _field The field.
+				 * @return A view of the field within the row, or an empty optional if its file has no column for the field.
+				 */
+				[[nodiscard]] std::optional<std::string_view> Raw(const typename T::Field& _field) const noexcept {
+					
+					const auto index = static_cast<size_t>(_field);
+					
+					if (m_Spans != nullptr) {
+						
+						const auto& span = m_Spans[index];
+						
+						return span.offset == s_None ?
+							std::nullopt :
+							std::optional<std::string_view>(m_Row.substr(span.offset, span.size));
+					}
+					
+					const auto column = m_Layout->columns[index];
+					
+					if (column == s_Missing) {
+						return std::nullopt;
+					}
+					
+					size_t current = 0U;
+					size_t start   = 0U;
+					
+					bool quoted = false;
+					
+					for (size_t i = 0U; i < m_Row.size(); ++i) {
+						
+						if (m_Row[i] == '"') {
+							quoted = !quoted;
+						}
+						else if (m_Row[i] == ',' && !quoted) {
+							
+							if (current == column) {
+								return m_Row.substr(start, i - start);
+							}
+							
+							++current;
+							start = i + 1U;
+						}
+					}
+					
+					// Rows are checked to have a column for every field when they are located.
+					return m_Row.substr(std::min(start, m_Row.size()));
+				}
+				
+				/**
+				 * @brief Parses a field.
+				 * @tparam F The field.
+				 * @return An optional containing the value of the field, or an empty optional if it cannot be parsed or its file has no column for the field.
+				 *
+				 * @note As in a record, a text field which is present but empty is an empty string.
+				 */
+				template <typename T::Field F>
+				[[nodiscard]] std::optional<ValueOf<F>> Get() const {
+					
+					const auto raw = Raw(F);
+					
+					if (!raw.has_value()) {
+						return std::nullopt;
+					}
+					
+					if constexpr (std::is_same_v<ValueOf<F>, std::string>) {
+						return std::string(*raw);
+					}
+					else {
+						return TryParse<ValueOf<F>>(*raw);
+					}
+				}
+				
+				/**
+				 * @brief Parses every field of the row into a record.
+				 * @return The record of the star.
+				 */
+				[[nodiscard]] T Deserialise() const {
+					
+					std::array<std::string_view, T::s_ElementCount> elements;
+					
+					if (m_Spans != nullptr) {
+						
+						for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+							elements[i] = Raw(static_cast<typename T::Field>(i)).value_or(std::string_view());
+						}
+					}
+					else if (m_Layout->fixed) {
+						
+						// The fields are in schema order, so the row is tokenised once rather than scanned for each field.
+						Tokenise(m_Row, elements);
+					}
+					else {
+						
+						std::array<std::string_view, s_MaxColumns> columns;
+						Tokenise(m_Row, columns);
+						
+						for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+							
+							if (m_Layout->columns[i] != s_Missing) {
+								elements[i] = columns[m_Layout->columns[i]];
+							}
+						}
+					}
+					
+					return T(elements);
+				}
+			};
+			
+		private:
+			
+			/**
+			 * @struct File
+			 * @brief The bytes of a file, and the layout of its header.
+			 */
+			struct File final {
+				
+				std::optional<MappedFile> mapping;
+				std::string               buffer;
+				
+				Layout<T> layout;
+			};
+			
+			/** @brief The files, which are never moved, so that records can reference them. */
+			std::vector<std::unique_ptr<File>> m_Files;
+			
+			/** @brief The index of the first row of each file. */
+			std::vector<size_t> m_Starts;
+			
+			/** @brief The bytes of each row, excluding its newline. */
+			std::vector<std::string_view> m_Rows;
+			
+			/** @brief The location of every field of each row, ordered by row then by column index, if the catalogue was opened with an offset table. */
+			std::vector<Span> m_Spans;
+			
+			/** @brief Whether the catalogue was opened with an offset table. */
+			bool m_Indexed;
+			
+			/**
+			 * @brief Locates the rows of a chunk of a file.
+			 * @param[in] _rows The chunk, which must begin at the start of a row and end after a newline or at the end of the file.
+			 * @param[in] _layout The layout of the file.
+			 * @param[out] _result The array to write the bytes of each row to, which must hold as many rows as Scanner::Count returns for the chunk.
+			 * @param[out] _spans The array to write the location of every field of each row to, or null to not record them.
+			 * @throw std::runtime_error If a row has too few fields, or is too long to record the locations of its fields.
+			 */
+			template <size_t _Nm, size_t _Limit>
+			static void Scan(const std::string_view& _rows, const Layout<T>& _layout, std::string_view* const _result, Span* const _spans) {
+				
+				const auto required = _layout.fixed ? T::s_ElementCount : _layout.count;
+				
+				size_t count = 0U;
+				
+				Scanner::Rows<_Nm, _Limit>(_rows, [&](const std::array<std::string_view, _Nm>& _fields, const size_t& _count) {
+					
+					if (_count < required) {
+						throw std::runtime_error(_layout.fixed ?
+							"Number of elements not consistent with ATHYG version!" :
+							"Number of elements not consistent with header!");
+					}
+					
+					const auto* const start = _fields[0U].data();
+					
+					// Each row ends where the next begins, so only its start is recorded until then.
+					_result[count] = std::string_view(start, 0U);
+					
+					if (_spans != nullptr) {
+						
+						auto* const spans = _spans + (count * T::s_ElementCount);
+						
+						size_t extent = 0U;
+						
+						for (size_t i = 0U; i < T::s_ElementCount; ++i) {
+							
+							const auto column = _layout.columns[i];
+							
+							if (column == s_Missing) {
+								spans[i] = { s_None, 0U };
+							}
+							else {
+								
+								const auto offset = static_cast<size_t>(_fields[column].data() - start);
+								
+								extent = std::max(extent, offset + _fields[column].size());
+								
+								spans[i] = { static_cast<uint16_t>(offset), static_cast<uint16_t>(_fields[column].size()) };
+							}
+						}
+						
+						if (extent >= s_None) {
+							throw std::runtime_error("Row is too long to record the offsets of its fields!");
+						}
+					}
+					
+					++count;
+				});
+				
+				const auto* const end = _rows.data() + _rows.size();
+				
+				for (size_t i = 0U; i < count; ++i) {
+					
+					const auto* const next = i + 1U < count ? _result[i + 1U].data() - 1U : end;
+					
+					std::string_view row(_result[i].data(), static_cast<size_t>(next - _result[i].data()));
+					
+					if (!row.empty() && row.back() == '\n') {
+						row.remove_suffix(1U);
+					}
+					
+					if (!row.empty() && row.back() == '\r') {
+						row.remove_suffix(1U);
+					}
+					
+					_result[i] = row;
+				}
+			}
+			
+		public:
+			
+			LazyCatalogue() noexcept :
+				m_Files(),
+				m_Starts(),
+				m_Rows(),
+				m_Spans(),
+				m_Indexed(false) {}
+			
+			/**
+			 * @brief Opens ATHYG dataset files, locating the rows of each without parsing them.
+			 *
+			 * Files are read with the source given by the options, and split into chunks which are scanned in parallel on the number of threads given by the options.
+			 *
+			 * @param[in] _athyg_paths The paths to the ATHYG CSV files.
+			 * @param[in] _options (optional) The options used to read the files. The projection, filter and diagnostics of a Load do not apply.
+			 * @param[in] _offsets (optional) Whether to record the offset of every field of every row, at four bytes per field, so that fields are found without tokenising their row. Defaults to false.
+			 * @return A catalogue of the rows of every file, in order.
+			 * @throw std::runtime_error If the specified path is not valid.
+			 * @throw std::runtime_error If a file cannot be read or mapped.
+			 * @throw std::runtime_error If a row has fewer fields than its header or the ATHYG version.
+			 */
+			static LazyCatalogue Open(const std::vector<std::filesystem::path>& _athyg_paths, const Options& _options = Options(), const bool& _offsets = false) {
+				
+				for (const auto& path : _athyg_paths) {
+					
+					if (!exists(path)) {
+						throw std::runtime_error("Path is not valid.");
+					}
+				}
+				
+				const auto threads = _options.threads == 0U ?
+					static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)) :
+					_options.threads;
+				
+				LazyCatalogue result;
+				result.m_Indexed = _offsets;
+				
+				for (const auto& path : _athyg_paths) {
+					
+					auto file = std::make_unique<File>();
+					
+					std::string_view rows;
+					
+					if (_options.source == Source::Mapped && Detect(path) == Compression::None) {
+						
+						file->mapping.emplace(path);
+						
+						const auto view = file->mapping->View();
+						const auto end  = view.find('\n');
+						
+						if (end != std::string_view::npos) {
+							file->layout = Map<T>(view.substr(0U, end), 0U);
+						}
+						
+						rows = SkipHeader(view);
+					}
+					else {
+						
+						file->buffer.reserve(static_cast<size_t>(file_size(path)));
+						
+						ReadBlocks(path, Source::Buffered, _options.chunk_size,
+							[&file](const std::string_view& _header) { file->layout = Map<T>(_header, 0U); },
+							[&file](const std::string_view& _block) { file->buffer.append(_block); return true; }
+						);
+						
+						rows = file->buffer;
+					}
+					
+					const auto chunks = Chunk(rows, std::max(_options.chunk_size, static_cast<size_t>(1U)));
+					
+					const auto& layout = file->layout;
+					
+					// Count the rows of each chunk, so that every chunk can be scanned into its place in the result.
+					std::vector<size_t> firsts(chunks.size() + 1U, 0U);
+					
+					ParallelFor(chunks.size(), threads, [&](const size_t& _i) {
+						firsts[_i + 1U] = Scanner::Count(chunks[_i]);
+					});
+					
+					firsts[0U] = result.m_Rows.size();
+					
+					for (size_t i = 0U; i < chunks.size(); ++i) {
+						firsts[i + 1U] += firsts[i];
+					}
+					
+					result.m_Starts.push_back(result.m_Rows.size());
+					result.m_Rows.resize(firsts.back());
+					
+					if (_offsets) {
+						result.m_Spans.resize(firsts.back() * T::s_ElementCount);
+					}
+					
+					ParallelFor(chunks.size(), threads, [&](const size_t& _i) {
+						
+						auto* const destination = result.m_Rows.data() + firsts[_i];
+						auto* const table       = _offsets ? result.m_Spans.data() + (firsts[_i] * T::s_ElementCount) : nullptr;
+						
+						// Only the fields which are recorded are stored, and the fields of the other rows are only counted.
+						if (layout.fixed) {
 							
-							// Deserialise the star.
-							result.emplace_back(T(ToArray<std::string_view, T::s_ElementCount>(std::move(elements))));
+							if (_offsets) {
+								Scan<T::s_ElementCount, T::s_ElementCount>(chunks[_i], layout, destination, table);
+							}
+							else {
+								Scan<T::s_ElementCount, 1U>(chunks[_i], layout, destination, table);
+							}
 						}
 						else {
-							throw std::runtime_error("Number of elements not consistent with ATHYG version!");
+							
+							if (_offsets) {
+								Scan<s_MaxColumns, s_MaxColumns>(chunks[_i], layout, destination, table);
+							}
+							else {
+								Scan<s_MaxColumns, 1U>(chunks[_i], layout, destination, table);
+							}
 						}
+					});
+					
+					result.m_Files.push_back(std::move(file));
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Returns the number of stars in the catalogue.
+			 * @return The number of rows.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Rows.size();
+			}
+			
+			/**
+			 * @brief Returns whether the catalogue contains no stars.
+			 * @return True if there are no rows, false otherwise.
+			 */
+			[[nodiscard]] bool Empty() const noexcept {
+				return m_Rows.empty();
+			}
+			
+			/**
+			 * @brief Returns whether the catalogue records the offset of every field of every row.
+			 * @return True if it was opened with an offset table, false otherwise.
+			 */
+			[[nodiscard]] bool Indexed() const noexcept {
+				return m_Indexed;
+			}
+			
+			/**
+			 * @brief Returns a view of the row of a star.
+			 * @param[in] _index The index of the row, which must be less than Size().
+			 * @return A view of the row, which parses its fields on access.
+			 */
+			[[nodiscard]] Record operator[](const size_t& _index) const noexcept {
+				
+				const auto file = static_cast<size_t>(std::upper_bound(m_Starts.begin(), m_Starts.end(), _index) - m_Starts.begin()) - 1U;
+				
+				return Record(
+					m_Rows[_index],
+					&m_Files[file]->layout,
+					m_Indexed ? m_Spans.data() + (_index * T::s_ElementCount) : nullptr
+				);
+			}
+		};
+		
+		/**
+		 * @class Handle
+		 * @brief Publishes immutable snapshots of a dataset, so that it can be replaced while other threads read it.
+		 *
+		 * Readers acquire the current snapshot without locking: each announces the epoch in which it reads the current snapshot in a slot,
+		 * takes a reference to it, then clears the slot, so that a reader is only ever announced for a few instructions.
+		 * Publishing a snapshot replaces the current snapshot, then waits until no reader announced before the replacement remains, before releasing it.
+		 *
+		 * Snapshots are reference-counted, so a snapshot which has been replaced is reclaimed once the last reader releases it.
+		 *
+		 * @code
+		 * using Catalogue = ATHYG::Catalogue<ATHYG::V3>;
+		 *
+		 * ATHYG::Handle<Catalogue> handle(Catalogue::Load(paths, "athyg_v3.bin"));
+		 *
+		 * // Query threads:
+		 * const auto catalogue = handle.Get();
+		 *
+		 * // Background thread:
+		 * handle.Publish(handle.Get()->Reload(paths, ATHYG::Options()));
+		 * @endcode
+		 *
+		 * @tparam C The type of the dataset, such as Catalogue<T> or std::vector<T>.
+		 *
+		 * @note Readers only wait if every slot is in use at once, which requires more concurrent readers than s_Slots.
+		 * @note The handle must not be destroyed while other threads use it, although snapshots acquired from it may outlive it.
+		 */
+		template <typename C>
+		class Handle final {
+			
+		public:
+			
+			/** @brief The number of readers which may acquire a snapshot at the same time without waiting. */
+			static constexpr size_t s_Slots { 64U };
+			
+		private:
+			
+			/** @brief The epoch announced by a reader, or zero if the slot is not in use. Slots are aligned to avoid false sharing between readers. */
+			struct alignas(64) Slot final {
+				std::atomic<uint64_t> epoch { 0U };
+			};
+			
+			mutable std::array<Slot, s_Slots> m_Slots;
+			
+			/** @brief The current epoch, incremented each time a snapshot is published. Starts at one, so that zero marks an unused slot. */
+			std::atomic<uint64_t> m_Epoch;
+			
+			std::atomic<const std::shared_ptr<const C>*> m_Current;
+			
+			/** @brief Serialises publishers. Never taken by readers. */
+			std::mutex m_Mutex;
+			
+		public:
+			
+			/**
+			 * @brief Creates a handle publishing a snapshot.
+			 * @param[in] _snapshot The first snapshot, which may be null.
+			 */
+			explicit Handle(std::shared_ptr<const C> _snapshot = nullptr) :
+				m_Slots(),
+				m_Epoch(1U),
+				m_Current(new std::shared_ptr<const C>(std::move(_snapshot))),
+				m_Mutex() {}
+			
+			/**
+			 * @brief Creates a handle publishing a snapshot of a dataset.
+			 * @param[in] _dataset The dataset, which is moved into the first snapshot.
+			 */
+			explicit Handle(C&& _dataset) :
+				Handle(std::make_shared<const C>(std::move(_dataset))) {}
+			
+			Handle(const Handle&) = delete;
+			Handle& operator = (const Handle&) = delete;
+			
+			~Handle() {
+				delete m_Current.load();
+			}
+			
+			/**
+			 * @brief Returns the current snapshot.
+			 *
+			 * The snapshot is immutable and remains valid for as long as it is referenced, regardless of whether it is replaced.
+			 * Acquire a snapshot once per query, rather than once per access, so that every access of a query sees the same dataset.
+			 *
+			 * @return The current snapshot, which may be null.
+			 */
+			[[nodiscard]] std::shared_ptr<const C> Get() const {
+				
+				// Start from a slot particular to the thread, so that threads rarely contend for a slot.
+				static thread_local const size_t s_Start = std::hash<std::thread::id>()(std::this_thread::get_id());
+				
+				for (size_t i = s_Start;; ++i) {
+					
+					auto& slot = m_Slots[i % s_Slots].epoch;
+					
+					uint64_t expected = 0U;
+					
+					// Announce the epoch before loading the snapshot, so that a publisher which replaces it observes the announcement.
+					if (slot.compare_exchange_strong(expected, m_Epoch.load())) {
+						
+						auto result = *m_Current.load();
+						
+						slot.store(0U);
+						
+						return result;
+					}
+					
+					if (i % s_Slots == (s_Start + s_Slots - 1U) % s_Slots) {
+						std::this_thread::yield();
 					}
 				}
-				else {
-					throw std::runtime_error("Path is not valid.");
+			}
+			
+			/**
+			 * @brief Replaces the current snapshot.
+			 *
+			 * Returns once no reader can acquire the previous snapshot, which readers holding it continue to use until they release it.
+			 *
+			 * @param[in] _snapshot The snapshot, which may be null.
+			 */
+			void Publish(std::shared_ptr<const C> _snapshot) {
+				
+				const std::lock_guard<std::mutex> lock(m_Mutex);
+				
+				const auto* const previous = m_Current.exchange(new std::shared_ptr<const C>(std::move(_snapshot)));
+				
+				// Readers which announced a later epoch loaded the new snapshot, so only wait for readers which announced this epoch or earlier.
+				const auto epoch = m_Epoch.fetch_add(1U);
+				
+				for (auto& slot : m_Slots) {
+					
+					for (auto announced = slot.epoch.load(); announced != 0U && announced <= epoch; announced = slot.epoch.load()) {
+						std::this_thread::yield();
+					}
 				}
 				
-				std::cout << "Done.\n";
+				delete previous;
 			}
 			
-			return result;
-		}
+			/**
+			 * @brief Replaces the current snapshot with a snapshot of a dataset.
+			 * @param[in] _dataset The dataset, which is moved into the snapshot.
+			 */
+			void Publish(C&& _dataset) {
+				Publish(std::make_shared<const C>(std::move(_dataset)));
+			}
+		};
+		
+		/**
+		 * @class Replicated
+		 * @brief Holds a read-only copy of a dataset on every NUMA node, so that query threads on each node only read local memory.
+		 *
+		 * Each replica is copied by a thread pinned to its node, which is first to touch, and so allocates locally, the memory of the replica.
+		 * On a machine with a single node, the dataset is held without being copied.
+		 *
+		 * @code
+		 * using Catalogue = ATHYG::Catalogue<ATHYG::V3>;
+		 *
+		 * const ATHYG::Replicated<Catalogue> replicas(Catalogue::Load(paths, "athyg_v3.bin"));
+		 *
+		 * // Query threads:
+		 * const auto& catalogue = replicas.Get();
+		 * @endcode
+		 *
+		 * Replicas may be published through a Handle, so that every replica is replaced at once:
+		 *
+		 * @code
+		 * ATHYG::Handle<ATHYG::Replicated<Catalogue>> handle(ATHYG::Replicated<Catalogue>(Catalogue::Load(paths, "athyg_v3.bin")));
+		 *
+		 * // Query threads:
+		 * const auto replicas = handle.Get();
+		 * const auto& catalogue = replicas->Get();
+		 * @endcode
+		 *
+		 * @tparam C The type of the dataset, such as Catalogue<T> or std::vector<T>. Must be copy-constructible.
+		 *
+		 * @note Replication multiplies the memory used by the dataset by the number of nodes.
+		 * @note Requires ATHYG_ENABLE_NUMA to be defined to replicate the dataset, otherwise every machine is treated as a single node.
+		 */
+		template <typename C>
+		class Replicated final {
+			
+			/** @brief The replica of each node, indexed by node. */
+			std::vector<std::unique_ptr<const C>> m_Replicas;
+			
+		public:
+			
+			/**
+			 * @brief Replicates a dataset on every NUMA node.
+			 * @param[in] _dataset The dataset, which is copied to every node, or moved if the machine has a single node.
+			 */
+			explicit Replicated(C&& _dataset) :
+				m_Replicas()
+			{
+				const auto nodes = Nodes();
+				
+				if (nodes <= 1U) {
+					m_Replicas.emplace_back(std::make_unique<const C>(std::move(_dataset)));
+				}
+				else {
+					
+					m_Replicas.resize(nodes);
+					
+					ParallelFor(nodes, nodes, [this, &_dataset](const size_t& _node) {
+						
+						const Pin pin(_node);
+						
+						m_Replicas[_node] = std::make_unique<const C>(_dataset);
+					});
+				}
+			}
+			
+			/**
+			 * @brief Returns the number of replicas.
+			 * @return The number of NUMA nodes, or 1 if the machine has a single node.
+			 */
+			[[nodiscard]] size_t Size() const noexcept {
+				return m_Replicas.size();
+			}
+			
+			/**
+			 * @brief Returns the replica of a NUMA node.
+			 * @param[in] _node The node.
+			 * @return A reference to the replica of the node, or of the last node if the node does not exist.
+			 */
+			[[nodiscard]] const C& Get(const size_t& _node) const noexcept {
+				return *m_Replicas[std::min(_node, m_Replicas.size() - 1U)];
+			}
+			
+			/**
+			 * @brief Returns the replica of the NUMA node of the calling thread.
+			 *
+			 * A thread may be moved to another node by the operating system unless it is pinned, so query threads should be pinned to a node,
+			 * and acquire the replica once per query.
+			 *
+			 * @return A reference to the replica of the node.
+			 */
+			[[nodiscard]] const C& Get() const noexcept {
+				return Get(Node());
+			}
+		};
 	};
 	
+	template<>
+	[[deprecated("Redundant operation: string_view to string conversion is not necessary.")]]
+	inline std::optional<std::string> ATHYG::TryParse(const std::string_view& _str) noexcept {
+		return std::string(_str);
+	}
+	
+	template<>
+	[[deprecated("Redundant operation: string_view to string_view conversion is not necessary.")]]
+	inline std::optional<std::string_view> ATHYG::TryParse(const std::string_view& _str) noexcept {
+		return _str;
+	}
+	
 } // LouiEriksson
 
 #endif //LOUIERIKSSON_ATHYG_HPP
\ No newline at end of file
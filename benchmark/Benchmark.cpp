@@ -0,0 +1,397 @@
+#include "Generator.hpp"
+
+#include "../ATHYG.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_WIN32)
+	#define NOMINMAX
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sys/resource.h>
+#endif
+
+// The replacement operator new allocates with malloc, so releasing with free is correct.
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+	
+	/** @brief The number of calls to the global operator new since the program started. */
+	std::atomic<size_t> s_Allocations { 0U };
+
+} // namespace
+
+void* operator new(std::size_t _size) {
+	
+	s_Allocations.fetch_add(1U, std::memory_order_relaxed);
+	
+	if (auto* result = std::malloc(_size == 0U ? 1U : _size)) {
+		return result;
+	}
+	
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t _size) {
+	return operator new(_size);
+}
+
+void operator delete(void* _ptr) noexcept {
+	std::free(_ptr);
+}
+
+void operator delete[](void* _ptr) noexcept {
+	std::free(_ptr);
+}
+
+void operator delete(void* _ptr, std::size_t) noexcept {
+	std::free(_ptr);
+}
+
+void operator delete[](void* _ptr, std::size_t) noexcept {
+	std::free(_ptr);
+}
+
+namespace LouiEriksson {
+	
+	/**
+	 * @struct ATHYGBenchmark
+	 * @brief Exposes the internal utilities of ATHYG to the benchmarks.
+	 */
+	struct ATHYGBenchmark final {
+		
+		template <typename T>
+		[[nodiscard]] static std::vector<T> Split(const std::string_view& _string, const char& _divider, const size_t& _capacity = 0U) {
+			return ATHYG::Split<T>(_string, _divider, _capacity);
+		}
+		
+		template <typename T>
+		[[nodiscard]] static std::optional<T> TryParse(const std::string_view& _string) noexcept {
+			return ATHYG::TryParse<T>(_string);
+		}
+		
+		template <size_t _Nm, typename F>
+		static void Rows(const std::string_view& _rows, F&& _func) {
+			ATHYG::Scanner::Rows<_Nm>(_rows, std::forward<F>(_func));
+		}
+	};
+
+} // LouiEriksson
+
+namespace {
+	
+	using LouiEriksson::ATHYG;
+	using LouiEriksson::ATHYGBenchmark;
+	using LouiEriksson::Benchmark::Generator;
+	
+	/** @brief The number of rows generated for the micro-benchmarks. */
+	constexpr size_t s_MicroRows { 10000U };
+	
+	/**
+	 * @brief Returns the peak resident set size of the process in bytes.
+	 */
+	[[nodiscard]] double PeakRSS() noexcept {
+	
+	#if defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS counters;
+		
+		return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) != 0 ?
+			static_cast<double>(counters.PeakWorkingSetSize) :
+			0.0;
+	#else
+		rusage usage {};
+		
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return 0.0;
+		}
+		
+		#if defined(__APPLE__)
+			return static_cast<double>(usage.ru_maxrss);
+		#else
+			return static_cast<double>(usage.ru_maxrss) * 1024.0;
+		#endif
+	#endif
+	}
+	
+	/**
+	 * @brief Returns the rows of a synthetic file, excluding the header.
+	 */
+	template <typename V>
+	[[nodiscard]] const std::string& Rows() {
+		
+		static const std::string result = []() {
+			
+			auto csv = Generator().Generate<V>(s_MicroRows);
+			
+			return csv.substr(csv.find('\n') + 1U);
+		}();
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Returns the lines of a synthetic file, excluding the header.
+	 */
+	template <typename V>
+	[[nodiscard]] const std::vector<std::string_view>& Lines() {
+		
+		static const auto result = []() {
+			
+			auto lines = ATHYGBenchmark::Split<std::string_view>(Rows<V>(), '\n');
+			
+			if (!lines.empty() && lines.back().empty()) {
+				lines.pop_back();
+			}
+			
+			return lines;
+		}();
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Returns every value of a field of a synthetic file, including empty values.
+	 */
+	template <typename V>
+	[[nodiscard]] std::vector<std::string_view> Values(const typename V::Field& _field) {
+		
+		std::vector<std::string_view> result;
+		
+		ATHYGBenchmark::Rows<V::s_ElementCount>(Rows<V>(), [&result, &_field](const std::array<std::string_view, V::s_ElementCount>& _row, const size_t&) {
+			result.push_back(_row[static_cast<size_t>(_field)]);
+		});
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Returns the path to a synthetic file in the temporary directory, generating it if it does not exist.
+	 */
+	template <typename V>
+	[[nodiscard]] std::filesystem::path Dataset(const size_t& _rows) {
+		
+		std::ostringstream name;
+		name << "athyg_benchmark_v" << (std::is_same_v<V, ATHYG::V1> ? 1 : std::is_same_v<V, ATHYG::V2> ? 2 : 3) << '_' << _rows << ".csv";
+		
+		auto result = std::filesystem::temp_directory_path() / name.str();
+		
+		if (!std::filesystem::exists(result)) {
+			
+			const auto partial = result.string() + ".tmp";
+			
+			Generator().Generate<V>(std::filesystem::path(partial), _rows);
+			std::filesystem::rename(partial, result);
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Reports the number of bytes and items processed, and the allocations per iteration since a starting count.
+	 */
+	void Report(benchmark::State& _state, const size_t& _bytes, const size_t& _items, const size_t& _allocations) {
+		
+		// Count the allocations first, as setting the counters below allocates.
+		const auto allocations = s_Allocations.load();
+		
+		const auto iterations = static_cast<double>(_state.iterations());
+		
+		_state.SetBytesProcessed(static_cast<int64_t>(_bytes * _state.iterations()));
+		_state.SetItemsProcessed(static_cast<int64_t>(_items * _state.iterations()));
+		
+		_state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations - _allocations) / iterations);
+		_state.counters["peak_rss"] = benchmark::Counter(PeakRSS(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+	}
+	
+	void Split(benchmark::State& _state) {
+		
+		const auto& lines = Lines<ATHYG::V3>();
+		
+		size_t bytes = 0U;
+		
+		for (const auto& line : lines) {
+			bytes += line.size();
+		}
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			
+			for (const auto& line : lines) {
+				benchmark::DoNotOptimize(ATHYGBenchmark::Split<std::string_view>(line, ',', ATHYG::V3::s_ElementCount));
+			}
+		}
+		
+		Report(_state, bytes, lines.size(), allocations);
+	}
+	
+	void Tokenise(benchmark::State& _state) {
+		
+		const auto& rows = Rows<ATHYG::V3>();
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			
+			ATHYGBenchmark::Rows<ATHYG::V3::s_ElementCount>(rows, [](const std::array<std::string_view, ATHYG::V3::s_ElementCount>& _row, const size_t&) {
+				benchmark::DoNotOptimize(_row.data());
+			});
+		}
+		
+		Report(_state, rows.size(), s_MicroRows, allocations);
+	}
+	
+	template <typename T>
+	void TryParse(benchmark::State& _state, const ATHYG::V3::Field& _field) {
+		
+		const auto values = Values<ATHYG::V3>(_field);
+		
+		size_t bytes = 0U;
+		
+		for (const auto& value : values) {
+			bytes += value.size();
+		}
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			
+			for (const auto& value : values) {
+				benchmark::DoNotOptimize(ATHYGBenchmark::TryParse<T>(value));
+			}
+		}
+		
+		Report(_state, bytes, values.size(), allocations);
+	}
+	
+	void Construct(benchmark::State& _state) {
+		
+		using V = ATHYG::V3;
+		
+		std::vector<std::array<std::string_view, V::s_ElementCount>> rows;
+		
+		ATHYGBenchmark::Rows<V::s_ElementCount>(Rows<V>(), [&rows](const std::array<std::string_view, V::s_ElementCount>& _row, const size_t&) {
+			rows.push_back(_row);
+		});
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			
+			for (const auto& row : rows) {
+				
+				V star(row);
+				benchmark::DoNotOptimize(star);
+			}
+		}
+		
+		Report(_state, Rows<V>().size(), rows.size(), allocations);
+	}
+	
+	/**
+	 * @brief Loads a synthetic file. The arguments are the number of rows, the number of threads (0 for every hardware thread), and whether to memory-map the file.
+	 */
+	template <typename V>
+	void Load(benchmark::State& _state) {
+		
+		const auto rows = static_cast<size_t>(_state.range(0U));
+		const auto path = Dataset<V>(rows);
+		
+		ATHYG::Options options;
+		options.threads = static_cast<size_t>(_state.range(1U));
+		options.source  = _state.range(2U) != 0 ? ATHYG::Source::Mapped : ATHYG::Source::Buffered;
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			benchmark::DoNotOptimize(ATHYG::Load<V>({ path }, options));
+		}
+		
+		Report(_state, static_cast<size_t>(std::filesystem::file_size(path)), rows, allocations);
+	}
+	
+	/**
+	 * @brief Advances the positions of every star of a synthetic file by one step. The arguments are the number of rows and the number of threads (0 for every hardware thread).
+	 */
+	void Propagate(benchmark::State& _state) {
+		
+		const auto rows = static_cast<size_t>(_state.range(0U));
+		const auto catalogue = ATHYG::Catalogue<ATHYG::V3>::Load({ Dataset<ATHYG::V3>(rows) });
+		
+		std::vector<float> x(catalogue.Size()), y(catalogue.Size()), z(catalogue.Size());
+		
+		const auto threads = static_cast<size_t>(_state.range(1U));
+		
+		const auto allocations = s_Allocations.load();
+		
+		for (auto _ : _state) {
+			
+			catalogue.Propagate(1000.0, x.data(), y.data(), z.data(), threads);
+			
+			benchmark::DoNotOptimize(x.data());
+			benchmark::DoNotOptimize(y.data());
+			benchmark::DoNotOptimize(z.data());
+			benchmark::ClobberMemory();
+		}
+		
+		Report(_state, catalogue.Size() * 6U * sizeof(double), catalogue.Size(), allocations);
+	}
+	
+	/** @brief Row counts of the end-to-end benchmarks. */
+	constexpr std::array<int64_t, 3U> s_Sizes { 100000, 1000000, 2500000 };
+	
+	[[maybe_unused]] const bool s_Registered = []() {
+		
+		benchmark::RegisterBenchmark("Micro/Split",              Split);
+		benchmark::RegisterBenchmark("Micro/Tokenise",           Tokenise);
+		benchmark::RegisterBenchmark("Micro/TryParse<double>",   TryParse<double>, ATHYG::V3::Field::x0);
+		benchmark::RegisterBenchmark("Micro/TryParse<size_t>",   TryParse<size_t>, ATHYG::V3::Field::gaia);
+		benchmark::RegisterBenchmark("Micro/Construct<V3>",      Construct);
+		
+		const auto hardware = static_cast<int64_t>(std::max(std::thread::hardware_concurrency(), 1U));
+		
+		for (const auto& source : { 0, 1 }) {
+			
+			benchmark::RegisterBenchmark("Load<V1>", Load<ATHYG::V1>)->Args({ s_Sizes[0U], 1, source })->Unit(benchmark::kMillisecond)->UseRealTime();
+			benchmark::RegisterBenchmark("Load<V2>", Load<ATHYG::V2>)->Args({ s_Sizes[0U], 1, source })->Unit(benchmark::kMillisecond)->UseRealTime();
+			
+			for (const auto& size : s_Sizes) {
+				
+				benchmark::RegisterBenchmark("Load<V3>", Load<ATHYG::V3>)->Args({ size, 1, source })->Unit(benchmark::kMillisecond)->UseRealTime();
+				
+				if (hardware > 1) {
+					benchmark::RegisterBenchmark("Load<V3>", Load<ATHYG::V3>)->Args({ size, hardware, source })->Unit(benchmark::kMillisecond)->UseRealTime();
+				}
+			}
+		}
+		
+		benchmark::RegisterBenchmark("Propagate<V3>", Propagate)->Args({ s_Sizes[1U], 1 })->Unit(benchmark::kMicrosecond)->UseRealTime();
+		
+		if (hardware > 1) {
+			benchmark::RegisterBenchmark("Propagate<V3>", Propagate)->Args({ s_Sizes[1U], hardware })->Unit(benchmark::kMicrosecond)->UseRealTime();
+		}
+		
+		return true;
+	}();
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,353 @@
+#ifndef LOUIERIKSSON_ATHYG_GENERATOR_HPP
+#define LOUIERIKSSON_ATHYG_GENERATOR_HPP
+
+#include "../ATHYG.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace LouiEriksson::Benchmark {
+	
+	/**
+	 * @class Generator
+	 * @brief Generates synthetic ATHYG CSV files for benchmarking.
+	 *
+	 * Rows are generated with approximately the field sparsity and string lengths of the published AT-HYG catalogue:
+	 * positions and magnitudes are nearly always present, Gaia and Tycho-2 identifiers usually, and Hipparcos, HD,
+	 * Bayer/Flamsteed designations and proper names rarely.
+	 *
+	 * Output is deterministic: the same version, row count and seed always produce the same file, since the generator uses its own
+	 * random number generator rather than the implementation-defined standard distributions, and formats every number with a fixed precision.
+	 */
+	class Generator final {
+		
+		/** @brief The state of the SplitMix64 random number generator. */
+		uint64_t m_State;
+		
+		[[nodiscard]] uint64_t Next() noexcept {
+			
+			auto result = (m_State += 0x9E3779B97F4A7C15ULL);
+			
+			result = (result ^ (result >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+			result = (result ^ (result >> 27U)) * 0x94D049BB133111EBULL;
+			
+			return result ^ (result >> 31U);
+		}
+		
+		/** @brief Returns a uniformly distributed number in [0, 1). */
+		[[nodiscard]] double Uniform() noexcept {
+			return static_cast<double>(Next() >> 11U) * 0x1.0p-53;
+		}
+		
+		/** @brief Returns a uniformly distributed number in [_min, _max). */
+		[[nodiscard]] double Uniform(const double& _min, const double& _max) noexcept {
+			return _min + ((_max - _min) * Uniform());
+		}
+		
+		/** @brief Returns a uniformly distributed integer in [_min, _max]. */
+		[[nodiscard]] uint64_t Integer(const uint64_t& _min, const uint64_t& _max) noexcept {
+			return _min + (Next() % (_max - _min + 1U));
+		}
+		
+		/** @brief Returns true with a probability. */
+		[[nodiscard]] bool Chance(const double& _probability) noexcept {
+			return Uniform() < _probability;
+		}
+		
+		template <size_t _Nm>
+		[[nodiscard]] std::string_view Pick(const std::array<std::string_view, _Nm>& _values) noexcept {
+			return _values[static_cast<size_t>(Next() % _Nm)];
+		}
+		
+		static void Append(std::string& _row, const char* _format, const double& _value) {
+			
+			std::array<char, 64U> buffer {};
+			
+			const auto length = std::snprintf(buffer.data(), buffer.size(), _format, _value);
+			
+			_row.append(buffer.data(), static_cast<size_t>(std::max(length, 0)));
+		}
+		
+		static void Append(std::string& _row, const uint64_t& _value) {
+			_row.append(std::to_string(_value));
+		}
+		
+		/**
+		 * @brief Appends one row, containing the columns of an ATHYG version in the order of its header.
+		 */
+		template <typename V>
+		void Row(const size_t& _id, std::string& _row) {
+			
+			static constexpr std::array<std::string_view, 4U>  sources       { "G", "H", "T", "V" };
+			static constexpr std::array<std::string_view, 12U> constellations { "And", "Aql", "Cen", "Cyg", "Ori", "Sgr", "Sco", "UMa", "Vir", "CMa", "Car", "Cas" };
+			static constexpr std::array<std::string_view, 8U>  bayer         { "Alp", "Bet", "Gam", "Del", "Eps", "Zet", "Eta", "The" };
+			static constexpr std::array<std::string_view, 8U>  proper        { "Sirius", "Canopus", "Arcturus", "Vega", "Capella", "Rigel", "Procyon", "Betelgeuse" };
+			static constexpr std::array<std::string_view, 10U> spectra       { "G2V", "K0III", "M1.5Iab", "A0V", "F5IV-V", "B8Ia", "K5V", "M3V", "DA2", "G8III-IV" };
+			
+			const auto ra   = Uniform(0.0, 24.0);
+			const auto dec  = std::asin(Uniform(-1.0, 1.0)) * (180.0 / ATHYG::s_Pi);
+			const auto dist = std::exp(Uniform(0.0, std::log(5000.0)));
+			const auto mag  = Uniform(-1.5, 21.0);
+			
+			const auto x = dist * std::cos(dec * (ATHYG::s_Pi / 180.0)) * std::cos(ra * (ATHYG::s_Pi / 12.0));
+			const auto y = dist * std::cos(dec * (ATHYG::s_Pi / 180.0)) * std::sin(ra * (ATHYG::s_Pi / 12.0));
+			const auto z = dist * std::sin(dec * (ATHYG::s_Pi / 180.0));
+			
+			const bool rv    = Chance(0.3);
+			const bool pm    = Chance(0.95);
+			const bool spect = Chance(0.2);
+			
+			for (size_t i = 0U; i < V::s_ElementCount; ++i) {
+				
+				const auto& name = V::s_Names[i];
+				
+				if (i != 0U) {
+					_row.push_back(',');
+				}
+				
+				if (name == "id") {
+					Append(_row, static_cast<uint64_t>(_id));
+				}
+				else if (name == "tyc") {
+					
+					if (Chance(0.55)) {
+						Append(_row, Integer(1U, 9537U));
+						_row.push_back('-');
+						Append(_row, Integer(1U, 12121U));
+						_row.append("-1");
+					}
+				}
+				else if (name == "gaia") {
+					
+					if (Chance(0.85)) {
+						Append(_row, Integer(1000000000000000000ULL, 6917528997577384320ULL));
+					}
+				}
+				else if (name == "hyg" || name == "hip") {
+					
+					if (Chance(0.05)) {
+						Append(_row, Integer(1U, 120000U));
+					}
+				}
+				else if (name == "hd") {
+					
+					if (Chance(0.09)) {
+						Append(_row, Integer(1U, 359083U));
+					}
+				}
+				else if (name == "hr") {
+					
+					if (Chance(0.004)) {
+						Append(_row, Integer(1U, 9110U));
+					}
+				}
+				else if (name == "gl") {
+					
+					if (Chance(0.002)) {
+						_row.append("Gl ");
+						Append(_row, Integer(1U, 915U));
+						_row.push_back('A');
+					}
+				}
+				else if (name == "bayer") {
+					
+					if (Chance(0.001)) {
+						_row.append(Pick(bayer));
+					}
+				}
+				else if (name == "flam") {
+					
+					if (Chance(0.001)) {
+						Append(_row, Integer(1U, 140U));
+					}
+				}
+				else if (name == "con") {
+					
+					if (Chance(0.95)) {
+						_row.append(Pick(constellations));
+					}
+				}
+				else if (name == "proper") {
+					
+					if (Chance(0.0002)) {
+						_row.append(Pick(proper));
+					}
+				}
+				else if (name == "ra") {
+					Append(_row, "%.6f", ra);
+				}
+				else if (name == "dec") {
+					Append(_row, "%.6f", dec);
+				}
+				else if (name == "dist") {
+					Append(_row, "%.4f", dist);
+				}
+				else if (name == "x0") {
+					Append(_row, "%.6f", x);
+				}
+				else if (name == "y0") {
+					Append(_row, "%.6f", y);
+				}
+				else if (name == "z0") {
+					Append(_row, "%.6f", z);
+				}
+				else if (name == "mag") {
+					Append(_row, "%.3f", mag);
+				}
+				else if (name == "absmag") {
+					Append(_row, "%.3f", mag - (5.0 * std::log10(dist / 10.0)));
+				}
+				else if (name == "ci") {
+					
+					if (Chance(0.6)) {
+						Append(_row, "%.3f", Uniform(-0.4, 2.5));
+					}
+				}
+				else if (name == "rv") {
+					
+					if (rv) {
+						Append(_row, "%.2f", Uniform(-120.0, 120.0));
+					}
+				}
+				else if (name == "rv_src") {
+					
+					if (rv) {
+						_row.append(Pick(sources));
+					}
+				}
+				else if (name == "pm_ra" || name == "pm_dec") {
+					
+					if (pm) {
+						Append(_row, "%.3f", Uniform(-500.0, 500.0));
+					}
+				}
+				else if (name == "pm_src") {
+					
+					if (pm) {
+						_row.append(Pick(sources));
+					}
+				}
+				else if (name == "vx" || name == "vy" || name == "vz") {
+					
+					if (rv) {
+						Append(_row, "%.8f", Uniform(-0.0001, 0.0001));
+					}
+				}
+				else if (name == "spect") {
+					
+					if (spect) {
+						_row.append(Pick(spectra));
+					}
+				}
+				else if (name == "spect_src") {
+					
+					if (spect) {
+						_row.append(Pick(sources));
+					}
+				}
+				else {
+					
+					// Source tags of positions, distances and magnitudes.
+					_row.append(Pick(sources));
+				}
+			}
+			
+			_row.push_back('\n');
+		}
+	
+	public:
+		
+		/**
+		 * @brief Creates a generator.
+		 * @param[in] _seed (optional) The seed of the random number generator. Defaults to 1.
+		 */
+		explicit Generator(const uint64_t& _seed = 1U) noexcept :
+			m_State(_seed) {}
+		
+		/**
+		 * @brief Writes a synthetic ATHYG CSV file, including its header, to a stream.
+		 * @tparam V The ATHYG dataset version (V1, V2, or V3).
+		 * @param[in,out] _stream The stream.
+		 * @param[in] _rows The number of rows to generate.
+		 */
+		template <typename V>
+		void Generate(std::ostream& _stream, const size_t& _rows) {
+			
+			std::string block;
+			
+			for (size_t i = 0U; i < V::s_ElementCount; ++i) {
+				
+				if (i != 0U) {
+					block.push_back(',');
+				}
+				
+				block.append(V::s_Names[i]);
+			}
+			
+			block.push_back('\n');
+			
+			for (size_t i = 0U; i < _rows; ++i) {
+				
+				Row<V>(i + 1U, block);
+				
+				if (block.size() >= 1U << 20U) {
+					_stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+					block.clear();
+				}
+			}
+			
+			_stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+		}
+		
+		/**
+		 * @brief Returns the contents of a synthetic ATHYG CSV file, including its header.
+		 * @tparam V The ATHYG dataset version (V1, V2, or V3).
+		 * @param[in] _rows The number of rows to generate.
+		 * @return The contents of the file.
+		 */
+		template <typename V>
+		[[nodiscard]] std::string Generate(const size_t& _rows) {
+			
+			std::ostringstream stream;
+			Generate<V>(stream, _rows);
+			
+			return stream.str();
+		}
+		
+		/**
+		 * @brief Writes a synthetic ATHYG CSV file to disk.
+		 * @tparam V The ATHYG dataset version (V1, V2, or V3).
+		 * @param[in] _path The path to the file, which is overwritten.
+		 * @param[in] _rows The number of rows to generate.
+		 * @throw std::runtime_error If the file cannot be written.
+		 */
+		template <typename V>
+		void Generate(const std::filesystem::path& _path, const size_t& _rows) {
+			
+			std::ofstream stream(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+			
+			if (!stream.is_open()) {
+				throw std::runtime_error("Failed to open \"" + _path.string() + "\" for writing!");
+			}
+			
+			Generate<V>(stream, _rows);
+			
+			if (!stream.good()) {
+				throw std::runtime_error("Failed to write \"" + _path.string() + "\"!");
+			}
+		}
+	};
+
+} // LouiEriksson::Benchmark
+
+#endif //LOUIERIKSSON_ATHYG_GENERATOR_HPP
@@ -0,0 +1,1401 @@
+#include "Generator.hpp"
+
+#include "../ATHYG.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @struct ATHYGTests
+	 * @brief Exposes the internal utilities of ATHYG to the tests.
+	 */
+	struct ATHYGTests final {
+		
+		template <size_t _Nm, size_t _Limit = _Nm, typename F>
+		static void Rows(const std::string_view& _rows, F&& _func) {
+			ATHYG::Scanner::Rows<_Nm, _Limit>(_rows, std::forward<F>(_func));
+		}
+		
+		[[nodiscard]] static size_t Count(const std::string_view& _rows) noexcept {
+			return ATHYG::Scanner::Count(_rows);
+		}
+		
+		template <size_t _Nm>
+		static size_t Tokenise(const std::string_view& _line, std::array<std::string_view, _Nm>& _fields) noexcept {
+			return ATHYG::Tokenise<_Nm>(_line, _fields);
+		}
+		
+		/**
+		 * @brief Reads a file in blocks with an AsyncFile, invoking a function once the file is open.
+		 */
+		template <typename F>
+		[[nodiscard]] static std::string Read(const std::filesystem::path& _path, const size_t& _block, F&& _opened) {
+			
+			ATHYG::AsyncFile file(_path, _block);
+			
+			_opened();
+			
+			std::string result;
+			std::string block;
+			
+			while (file.Next(block)) {
+				result += block;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Simulates a collision of hashes, by inserting a slot with the hash of a Tycho-2 identifier but the index of another star
+		 * at the start of its probe sequence, so the identifier is only found if the identifiers of the stars are compared.
+		 */
+		template <typename T>
+		static void Collide(const ATHYG::IdentifierIndex<T>& _index, const std::string_view& _id, const size_t& _other) {
+			
+			using Index = ATHYG::IdentifierIndex<T>;
+			using F     = typename T::Field;
+			
+			static_cast<void>(_index.template Build<F::tyc>());
+			
+			auto& slots = _index.m_Tables[Index::template Position<F::tyc>()].slots;
+			
+			const auto key  = Index::template Hash<F::tyc>(_id);
+			const auto mask = slots.size() - 1U;
+			
+			// Moving the occupant of the first slot to the end of its run keeps it reachable by linear probing.
+			auto bucket = Index::Bucket(key, mask);
+			auto empty  = bucket;
+			
+			while (slots[empty].index != Index::s_NotFound) {
+				empty = (empty + 1U) & mask;
+			}
+			
+			slots[empty]  = slots[bucket];
+			slots[bucket] = { key, _other };
+		}
+	};
+
+} // LouiEriksson
+
+namespace {
+	
+	using LouiEriksson::ATHYG;
+	using LouiEriksson::ATHYGTests;
+	using LouiEriksson::Benchmark::Generator;
+	
+	using V3 = ATHYG::V3;
+	using F  = V3::Field;
+	
+	using Catalogue = ATHYG::Catalogue<V3>;
+	
+	/** @brief The number of rows generated for each file. */
+	constexpr size_t s_Rows { 5000U };
+	
+	/**
+	 * @brief Throws if a condition does not hold, failing the current test.
+	 */
+	void Check(const bool& _condition, const std::string_view& _message) {
+		
+		if (!_condition) {
+			throw std::runtime_error(std::string(_message));
+		}
+	}
+	
+	/**
+	 * @brief Returns an empty directory in the temporary directory, in which the tests write their files.
+	 */
+	[[nodiscard]] const std::filesystem::path& Directory() {
+		
+		static const auto result = []() {
+			
+			// Named at random, so that several test executables can run at the same time.
+			auto path = std::filesystem::temp_directory_path() / ("athyg_tests_" + std::to_string(std::random_device()()));
+			
+			std::filesystem::remove_all(path);
+			std::filesystem::create_directories(path);
+			
+			return path;
+		}();
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Writes a synthetic V3 file to the test directory.
+	 */
+	[[nodiscard]] std::filesystem::path Dataset(const std::string& _name, const uint64_t& _seed = 1U) {
+		
+		auto result = Directory() / _name;
+		
+		Generator(_seed).Generate<V3>(result, s_Rows);
+		
+		return result;
+	}
+	
+	[[nodiscard]] std::string ReadFile(const std::filesystem::path& _path) {
+		
+		std::ifstream stream(_path, std::ios::in | std::ios::binary);
+		
+		return { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+	}
+	
+	void WriteFile(const std::filesystem::path& _path, const std::string& _contents) {
+		
+		std::ofstream stream(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		stream.write(_contents.data(), static_cast<std::streamsize>(_contents.size()));
+	}
+	
+	/**
+	 * @brief Renames the x0 column of a file to y0 and the y0 column to x0, changing only its header.
+	 */
+	void SwapHeader(const std::filesystem::path& _path) {
+		
+		auto contents = ReadFile(_path);
+		
+		const auto end = contents.find('\n');
+		const auto at  = contents.substr(0U, end).find(",x0,y0,");
+		
+		Check(at != std::string::npos, "Header does not contain x0 followed by y0!");
+		
+		contents.replace(at, 7U, ",y0,x0,");
+		
+		WriteFile(_path, contents);
+	}
+	
+	template <size_t... Is>
+	[[nodiscard]] bool Equal(const V3& _a, const V3& _b, std::index_sequence<Is...>) {
+		return ((_a.*(std::get<Is>(V3::s_Schema).member) == _b.*(std::get<Is>(V3::s_Schema).member)) && ...);
+	}
+	
+	/**
+	 * @brief Returns whether every field of two records is equal.
+	 */
+	[[nodiscard]] bool Equal(const V3& _a, const V3& _b) {
+		return Equal(_a, _b, std::make_index_sequence<V3::s_ElementCount>());
+	}
+	
+	template <size_t I>
+	[[nodiscard]] bool Equal(const Catalogue& _catalogue, const size_t& _row, const V3& _star) {
+		
+		const auto& column = _catalogue.template Get<static_cast<F>(I)>();
+		const auto& value  = _star.*(std::get<I>(V3::s_Schema).member);
+		
+		// Text is present in a catalogue only if it is not empty.
+		if constexpr (std::is_same_v<std::decay_t<decltype(*value)>, std::string>) {
+			return std::string_view(value.value_or(std::string())) == column[_row];
+		}
+		else {
+			return column.HasValue(_row) == value.has_value() && (!value.has_value() || column[_row] == *value);
+		}
+	}
+	
+	template <size_t... Is>
+	[[nodiscard]] bool Equal(const Catalogue& _catalogue, const size_t& _row, const V3& _star, std::index_sequence<Is...>) {
+		return (Equal<Is>(_catalogue, _row, _star) && ...);
+	}
+	
+	/**
+	 * @brief Returns whether a catalogue holds the same stars as a vector, in the same order.
+	 */
+	[[nodiscard]] bool Equal(const Catalogue& _catalogue, const std::vector<V3>& _stars) {
+		
+		if (_catalogue.Size() != _stars.size()) {
+			return false;
+		}
+		
+		for (size_t i = 0U; i < _stars.size(); ++i) {
+			
+			if (!Equal(_catalogue, i, _stars[i], std::make_index_sequence<V3::s_ElementCount>())) {
+				return false;
+			}
+		}
+		
+		return true;
+	}
+	
+	void HeaderMapping() {
+		
+		const std::vector<std::filesystem::path> positional { Dataset("header.csv") };
+		const std::vector<std::filesystem::path> mapped     { Dataset("header_mapped.csv") };
+		
+		SwapHeader(mapped[0U]);
+		
+		const auto stars = ATHYG::Load<V3>(positional);
+		
+		// The columns named x0 and y0 are exchanged, so the fields read from them must be too.
+		for (const auto& source : { ATHYG::Source::Buffered, ATHYG::Source::Mapped }) {
+			
+			ATHYG::Options options;
+			options.source = source;
+			
+			auto swapped = ATHYG::Load<V3>(mapped, options);
+			
+			Check(swapped.size() == stars.size(), "Mapped file has a different number of stars!");
+			
+			for (auto& star : swapped) {
+				std::swap(star.x0, star.y0);
+			}
+			
+			for (size_t i = 0U; i < stars.size(); ++i) {
+				Check(Equal(swapped[i], stars[i]), "Fields were not read from the columns named by the header!");
+			}
+			
+			Check(Equal(Catalogue::Load(mapped, options), ATHYG::Load<V3>(mapped, options)), "Catalogue did not read the columns named by the header!");
+		}
+	}
+	
+	void CacheHeaderChange() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("cache_header.csv") };
+		
+		const auto cache = Directory() / "cache_header.bin";
+		
+		static_cast<void>(Catalogue::Load(paths, cache, ATHYG::Options()));
+		
+		// The rows are unchanged, so only the header distinguishes the file from the one cached.
+		SwapHeader(paths[0U]);
+		
+		const auto stars = ATHYG::Load<V3>(paths);
+		
+		Check(Equal(Catalogue::Load(paths, cache, ATHYG::Options()), stars), "Cache was used for a file whose header has changed!");
+	}
+	
+	void CacheRoundTrip() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("round_trip_1.csv", 1U), Dataset("round_trip_2.csv", 2U) };
+		
+		const auto cache = Directory() / "round_trip.bin";
+		const auto stars = ATHYG::Load<V3>(paths);
+		
+		const auto parsed = Catalogue::Load(paths, cache, ATHYG::Options());
+		
+		Check(std::filesystem::exists(cache), "Cache was not written!");
+		Check(Equal(parsed, stars), "Parsed catalogue differs from Load!");
+		
+		const auto cached = Catalogue::Load(paths, cache, ATHYG::Options());
+		
+		Check(Equal(cached, stars), "Cached catalogue differs from Load!");
+		Check(Equal(Catalogue::Open(cache), stars), "Opened cache differs from Load!");
+	}
+	
+	void CorruptCache() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("corrupt.csv") };
+		
+		const auto cache = Directory() / "corrupt.bin";
+		
+		Catalogue::Load(paths).Save(cache);
+		
+		// Overwrite the file count, which follows the magic and the format, version and field count.
+		auto contents = ReadFile(cache);
+		contents.replace(20U, 4U, 4U, '\xFF');
+		WriteFile(cache, contents);
+		
+		bool threw = false;
+		
+		try {
+			static_cast<void>(Catalogue::Open(cache));
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		
+		Check(threw, "Cache with a corrupt file count was opened!");
+		Check(Equal(Catalogue::Load(paths, cache, ATHYG::Options()), ATHYG::Load<V3>(paths)), "Load did not recover from a corrupt cache!");
+	}
+	
+	void Filter() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("filter.csv") };
+		
+		const auto stars = ATHYG::Load<V3>(paths);
+		
+		// Gaia identifiers exceed the 53 bits of precision of a double, so neighbouring identifiers must be told apart.
+		size_t gaia = 0U;
+		
+		for (const auto& star : stars) {
+			
+			if (star.gaia.value_or(0U) > (static_cast<size_t>(1U) << 53U)) {
+				gaia = *star.gaia;
+				break;
+			}
+		}
+		
+		Check(gaia != 0U, "No Gaia identifier exceeds 2^53!");
+		
+		for (const auto& operand : { gaia, gaia + 1U }) {
+			
+			ATHYG::Filter<V3> filter;
+			filter.Where(F::gaia, ATHYG::Comparison::Equal, operand);
+			
+			size_t expected = 0U;
+			
+			for (const auto& star : stars) {
+				expected += static_cast<size_t>(star.gaia == operand);
+			}
+			
+			Check(ATHYG::Load<V3>(paths, ATHYG::Options(), filter).size() == expected, "Filter on a Gaia identifier is not exact!");
+		}
+		
+		ATHYG::Filter<V3> filter;
+		filter.Where(F::mag, ATHYG::Comparison::Less, 6.5)
+		      .Where(F::hip, ATHYG::Comparison::HasValue);
+		
+		std::vector<V3> expected;
+		
+		for (const auto& star : stars) {
+			
+			if (star.mag.has_value() && *star.mag < 6.5 && star.hip.has_value()) {
+				expected.push_back(star);
+			}
+		}
+		
+		const auto filtered = ATHYG::Load<V3>(paths, ATHYG::Options(), filter);
+		
+		Check(filtered.size() == expected.size(), "Filter kept a different number of stars to the predicate!");
+		
+		for (size_t i = 0U; i < expected.size(); ++i) {
+			Check(Equal(filtered[i], expected[i]), "Filter kept a different star to the predicate!");
+		}
+		
+		bool threw = false;
+		
+		try {
+			ATHYG::Filter<V3>().Where(F::proper, ATHYG::Comparison::Less, 1.0);
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		
+		Check(threw, "Filter compared a text field!");
+	}
+	
+	void Reload() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("reload_1.csv", 1U), Dataset("reload_2.csv", 2U) };
+		
+		const auto catalogue = Catalogue::Load(paths, Directory() / "reload.bin", ATHYG::Options());
+		
+		Check(Equal(catalogue.Reload(paths), ATHYG::Load<V3>(paths)), "Reload of unchanged files differs from Load!");
+		
+		Generator(3U).Generate<V3>(paths[1U], s_Rows / 2U);
+		
+		const auto changed = catalogue.Reload(paths);
+		
+		Check(Equal(changed, ATHYG::Load<V3>(paths)), "Reload of a changed file differs from Load!");
+		
+		SwapHeader(paths[0U]);
+		
+		Check(Equal(changed.Reload(paths), ATHYG::Load<V3>(paths)), "Reload ignored a change to the header of a file!");
+	}
+	
+	void Handle() {
+		
+		const std::vector<std::filesystem::path> paths { Dataset("handle.csv") };
+		
+		auto stars = ATHYG::Load<V3>(paths);
+		
+		const auto size = stars.size();
+		
+		ATHYG::Handle<std::vector<V3>> handle(std::move(stars));
+		
+		const auto first = handle.Get();
+		
+		Check(first != nullptr && first->size() == size, "Handle did not publish its first snapshot!");
+		
+		std::atomic<bool> stop { false };
+		std::atomic<bool> valid { true };
+		
+		std::vector<std::thread> readers;
+		
+		for (size_t i = 0U; i < 4U; ++i) {
+			
+			readers.emplace_back([&handle, &stop, &valid, &size]() {
+				
+				while (!stop.load()) {
+					
+					const auto snapshot = handle.Get();
+					
+					if (snapshot == nullptr || (snapshot->size() != size && snapshot->size() != 1U)) {
+						valid.store(false);
+					}
+				}
+			});
+		}
+		
+		for (size_t i = 0U; i < 100U; ++i) {
+			handle.Publish(std::make_shared<const std::vector<V3>>(i % 2U == 0U ? std::vector<V3>(1U, first->front()) : *first));
+		}
+		
+		stop.store(true);
+		
+		for (auto& reader : readers) {
+			reader.join();
+		}
+		
+		Check(valid.load(), "A reader acquired a snapshot which was never published!");
+		Check(first->size() == size, "A replaced snapshot was released while referenced!");
+		Check(handle.Get()->size() == size, "Handle did not publish its last snapshot!");
+	}
+	
+	void LazyCatalogue() {
+		
+		const std::vector<std::filesystem::path> positional { Dataset("lazy.csv") };
+		const std::vector<std::filesystem::path> mapped     { Dataset("lazy_mapped.csv") };
+		
+		// Reorder the header, so that the fields are found from it rather than from fixed positions.
+		SwapHeader(mapped[0U]);
+		
+		for (const auto& paths : { positional, mapped }) {
+			
+			const auto stars = ATHYG::Load<V3>(paths);
+			
+			for (const auto& offsets : { false, true }) {
+				
+				const auto lazy = ATHYG::LazyCatalogue<V3>::Open(paths, ATHYG::Options(), offsets);
+				
+				Check(lazy.Size() == stars.size(), "Lazy catalogue has a different number of stars to Load!");
+				
+				for (size_t i = 0U; i < stars.size(); ++i) {
+					
+					const auto record = lazy[i];
+					
+					Check(Equal(record.Deserialise(), stars[i]), "Lazy record differs from Load!");
+					Check(record.Get<F::x0>() == stars[i].x0, "Lazy field differs from Load!");
+				}
+			}
+		}
+	}
+	
+	/**
+	 * @brief Splits CSV rows one character at a time, as the reference for the Scanner.
+	 *
+	 * Commas and newlines within double quotes are part of their field, and a carriage return is stripped from the end of each row.
+	 */
+	[[nodiscard]] std::vector<std::vector<std::string_view>> Reference(const std::string_view& _rows) {
+		
+		std::vector<std::vector<std::string_view>> result;
+		std::vector<std::string_view> row;
+		
+		size_t start = 0U;
+		
+		bool quoted = false;
+		
+		const auto emit = [&](const size_t& _end) {
+			
+			std::string_view field(_rows.data() + start, _end - start);
+			
+			if (!field.empty() && field.back() == '\r') {
+				field.remove_suffix(1U);
+			}
+			
+			row.push_back(field);
+			result.push_back(std::move(row));
+			row.clear();
+		};
+		
+		for (size_t i = 0U; i < _rows.size(); ++i) {
+			
+			if (_rows[i] == '"') {
+				quoted = !quoted;
+			}
+			else if (!quoted && _rows[i] == ',') {
+				row.emplace_back(_rows.data() + start, i - start);
+				start = i + 1U;
+			}
+			else if (!quoted && _rows[i] == '\n') {
+				emit(i);
+				start = i + 1U;
+			}
+		}
+		
+		if (start < _rows.size() || !row.empty()) {
+			emit(_rows.size());
+		}
+		
+		return result;
+	}
+	
+	/**
+	 * @brief Generates CSV rows of random fields, including quoted commas and newlines, escaped quotes, empty fields and CRLF line endings.
+	 *
+	 * Rows are of varying length, so that they begin and end at every position within the blocks of the Scanner, and the last row is not terminated.
+	 */
+	[[nodiscard]] std::string Rows(const size_t& _rows) {
+		
+		static constexpr std::array<std::string_view, 8U> s_Fields {
+			"", "1.5", "-42", "Sirius", "\"Alpha, Beta\"", "\"line\nbreak\"", "\"say \"\"hi\"\"\"", "G2V"
+		};
+		
+		std::string result;
+		
+		uint64_t state = 1U;
+		
+		const auto next = [&state]() {
+			
+			state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+			
+			return state >> 33U;
+		};
+		
+		for (size_t i = 0U; i < _rows; ++i) {
+			
+			const auto fields = 1U + (next() % 40U);
+			
+			for (size_t j = 0U; j < fields; ++j) {
+				
+				if (j != 0U) {
+					result.push_back(',');
+				}
+				
+				result.append(s_Fields[next() % s_Fields.size()]);
+			}
+			
+			if (i + 1U != _rows) {
+				result.append(next() % 2U == 0U ? "\n" : "\r\n");
+			}
+		}
+		
+		return result;
+	}
+	
+	void Scanner() {
+		
+		const auto rows = Rows(2000U);
+		
+		// Offset the rows by every position within a block.
+		for (size_t offset = 0U; offset < 64U; ++offset) {
+			
+			const std::string_view view(rows.data() + offset, rows.size() - offset);
+			
+			const auto expected = Reference(view);
+			
+			Check(ATHYGTests::Count(view) == expected.size(), "Count differs from the reference!");
+			
+			std::vector<std::vector<std::string_view>> all;
+			
+			ATHYGTests::Rows<64U>(view, [&all](const std::array<std::string_view, 64U>& _fields, const size_t& _count) {
+				all.emplace_back(_fields.begin(), _fields.begin() + static_cast<std::ptrdiff_t>(std::min(_count, _fields.size())));
+			});
+			
+			Check(all == expected, "Rows differs from the reference!");
+			
+			// Rows with more fields than are stored are counted in bulk.
+			size_t row = 0U;
+			
+			ATHYGTests::Rows<8U, 4U>(view, [&expected, &row](const std::array<std::string_view, 8U>& _fields, const size_t& _count) {
+				
+				const auto& reference = expected[row++];
+				
+				Check(_count == reference.size(), "Rows counted a different number of fields to the reference!");
+				
+				for (size_t i = 0U; i < std::min(_count, static_cast<size_t>(4U)); ++i) {
+					Check(_fields[i] == reference[i], "Rows stored a different field to the reference!");
+				}
+			});
+			
+			Check(row == expected.size(), "Rows produced a different number of rows to the reference!");
+		}
+		
+		// Each row tokenised alone, with and without its line ending. An empty line has no fields unless it is terminated.
+		for (const auto& reference : Reference(rows)) {
+			
+			const std::string_view line(reference.front().data(), static_cast<size_t>((reference.back().data() + reference.back().size()) - reference.front().data()));
+			
+			for (const auto& text : { std::string(line), std::string(line) + "\r\n" }) {
+				
+				if (text.empty()) {
+					continue;
+				}
+				
+				std::array<std::string_view, 64U> fields;
+				
+				const auto count = ATHYGTests::Tokenise(text, fields);
+				
+				Check(count == reference.size(), "Tokenise counted a different number of fields to the reference!");
+				
+				for (size_t i = 0U; i < count; ++i) {
+					Check(fields[i] == reference[i], "Tokenise produced a different field to the reference!");
+				}
+			}
+		}
+	}
+	
+	void KDTree() {
+		
+		using Tree  = ATHYG::KDTree<V3>;
+		using Point = Tree::Point;
+		
+		const std::vector<std::filesystem::path> paths { Dataset("kdtree.csv") };
+		
+		const auto stars = ATHYG::Load<V3>(paths);
+		
+		// The squared distance of each star with a position from a point, computed as the tree does.
+		const auto distances = [&stars](const Point& _centre) {
+			
+			std::vector<std::pair<double, size_t>> result;
+			
+			for (size_t i = 0U; i < stars.size(); ++i) {
+				
+				const auto& star = stars[i];
+				
+				if (star.x0.has_value() && star.y0.has_value() && star.z0.has_value()) {
+					
+					const auto x = *star.x0 - _centre[0U];
+					const auto y = *star.y0 - _centre[1U];
+					const auto z = *star.z0 - _centre[2U];
+					
+					result.emplace_back((x * x) + (y * y) + (z * z), i);
+				}
+			}
+			
+			std::sort(result.begin(), result.end());
+			
+			return result;
+		};
+		
+		const auto position = [&stars](const size_t& _index) -> Point {
+			return { *stars[_index].x0, *stars[_index].y0, *stars[_index].z0 };
+		};
+		
+		const std::vector<Point> centres { { 0.0, 0.0, 0.0 }, position(0U), position(stars.size() / 2U), { 1000.0, -2000.0, 500.0 } };
+		
+		const Tree vector(stars, 2U);
+		const Tree catalogue(Catalogue::Load(paths));
+		
+		std::vector<size_t> nearest;
+		Tree::Heap heap;
+		
+		for (const auto* const tree : { &vector, &catalogue }) {
+			
+			for (const auto& centre : centres) {
+				
+				const auto expected = distances(centre);
+				
+				for (const auto& radius : { 0.0, 5.0, 50.0, 500.0, 5000.0 }) {
+					
+					std::vector<size_t> inside;
+					
+					for (const auto& [distance, index] : expected) {
+						
+						if (distance <= radius * radius) {
+							inside.push_back(index);
+						}
+					}
+					
+					auto found = tree->Radius(centre, radius);
+					std::sort(found.begin(), found.end());
+					std::sort(inside.begin(), inside.end());
+					
+					Check(found == inside, "Radius differs from a brute-force scan!");
+				}
+				
+				// Reuse the buffers of the queries, including after a query larger than the catalogue.
+				for (const auto& count : { static_cast<size_t>(1U), static_cast<size_t>(100U), stars.size() + 1U, static_cast<size_t>(10U), static_cast<size_t>(0U) }) {
+					
+					tree->Nearest(centre, count, nearest, heap);
+					
+					Check(nearest.size() == std::min(count, expected.size()), "Nearest found the wrong number of stars!");
+					Check(nearest == tree->Nearest(centre, count), "Nearest differs when reusing a heap!");
+					
+					// Stars at the same distance may be found in either order, so compare their distances.
+					for (size_t i = 0U; i < nearest.size(); ++i) {
+						
+						const auto& star = stars[nearest[i]];
+						
+						const auto x = *star.x0 - centre[0U];
+						const auto y = *star.y0 - centre[1U];
+						const auto z = *star.z0 - centre[2U];
+						
+						Check((x * x) + (y * y) + (z * z) == expected[i].first, "Nearest is not ordered by distance!");
+					}
+				}
+			}
+			
+			// A box whose corners are the positions of two stars, which therefore lie on its faces.
+			const auto a = position(1U);
+			const auto b = position(2U);
+			
+			const Point min { std::min(a[0U], b[0U]), std::min(a[1U], b[1U]), std::min(a[2U], b[2U]) };
+			const Point max { std::max(a[0U], b[0U]), std::max(a[1U], b[1U]), std::max(a[2U], b[2U]) };
+			
+			std::vector<size_t> within;
+			
+			for (size_t i = 0U; i < stars.size(); ++i) {
+				
+				const auto& star = stars[i];
+				
+				if (star.x0.has_value() && star.y0.has_value() && star.z0.has_value() &&
+				    *star.x0 >= min[0U] && *star.x0 <= max[0U] &&
+				    *star.y0 >= min[1U] && *star.y0 <= max[1U] &&
+				    *star.z0 >= min[2U] && *star.z0 <= max[2U]
+				) {
+					within.push_back(i);
+				}
+			}
+			
+			auto found = tree->Within(min, max);
+			std::sort(found.begin(), found.end());
+			
+			Check(found == within, "Within differs from a brute-force scan!");
+			Check(std::binary_search(found.begin(), found.end(), 1U) && std::binary_search(found.begin(), found.end(), 2U), "Within excluded a star on a face of the box!");
+		}
+	}
+	
+	void SkyGrid() {
+		
+		using Grid = ATHYG::SkyGrid<V3>;
+		
+		const std::vector<std::filesystem::path> paths { Dataset("skygrid.csv") };
+		
+		const auto stars = ATHYG::Load<V3>(paths);
+		
+		// Compares the result of a query with the stars satisfying a predicate, in any order.
+		const auto compare = [&stars](std::vector<size_t> _found, const double& _magnitude, const auto& _predicate, const std::string_view& _query) {
+			
+			std::vector<size_t> expected;
+			
+			for (size_t i = 0U; i < stars.size(); ++i) {
+				
+				const auto& star = stars[i];
+				
+				if (star.ra.has_value() && star.dec.has_value() && star.mag.value_or(std::numeric_limits<double>::infinity()) <= _magnitude && _predicate(*star.ra, *star.dec)) {
+					expected.push_back(i);
+				}
+			}
+			
+			std::sort(_found.begin(), _found.end());
+			
+			Check(_found == expected, std::string(_query) + " differs from a brute-force scan!");
+		};
+		
+		const auto direction = [](const double& _ra, const double& _dec) -> std::array<double, 3U> {
+			
+			// As computed by the grid.
+			const auto ra  = _ra  * (ATHYG::s_Pi / 12.0);
+			const auto dec = _dec * (ATHYG::s_Pi / 180.0);
+			
+			return { std::cos(dec) * std::cos(ra), std::cos(dec) * std::sin(ra), std::sin(dec) };
+		};
+		
+		// Cones containing a pole, reaching past it, or covering more than a hemisphere.
+		const std::vector<std::tuple<double, double, double>> cones {
+			{  6.0,   0.0,   0.0 },
+			{  3.0,  30.0,  10.0 },
+			{ 23.5, -20.0,  25.0 },
+			{  1.0,  89.0,   0.5 },
+			{  7.0,  89.0,   5.0 },
+			{ 19.0, -89.0,   5.0 },
+			{ 12.0,  60.0,  45.0 },
+			{  2.0,  10.0, 120.0 },
+			{  0.0,   0.0, 200.0 },
+		};
+		
+		// Rectangles wrapping through 0 hours, containing a pole, or degenerate.
+		const std::vector<std::tuple<double, double, double, double>> rectangles {
+			{  2.0,  4.0, -10.0,  10.0 },
+			{ 22.0,  2.0, -30.0,  30.0 },
+			{ 23.9,  0.1,  80.0,  90.0 },
+			{  0.0, 24.0, -90.0, -85.0 },
+			{  5.0,  5.0, -90.0,  90.0 },
+			{  6.0,  8.0,  20.0, -20.0 },
+		};
+		
+		for (const auto& resolution : { 1.0, 7.5, 180.0 }) {
+			
+			const Grid vector(stars, resolution);
+			const Grid catalogue(Catalogue::Load(paths), resolution);
+			
+			for (const auto* const grid : { &vector, &catalogue }) {
+				
+				for (const auto& magnitude : { std::numeric_limits<double>::infinity(), 6.5, -2.0 }) {
+					
+					for (const auto& [ra, dec, radius] : cones) {
+						
+						const auto centre  = direction(ra, dec);
+						const auto minimum = std::cos(std::min(radius, 180.0) * (ATHYG::s_Pi / 180.0));
+						
+						compare(grid->Cone(ra, dec, radius, magnitude), magnitude, [&](const double& _ra, const double& _dec) {
+							
+							const auto star = direction(_ra, _dec);
+							
+							return (star[0U] * centre[0U]) + (star[1U] * centre[1U]) + (star[2U] * centre[2U]) >= minimum;
+							
+						}, "Cone");
+					}
+					
+					for (const auto& [ra_min, ra_max, dec_min, dec_max] : rectangles) {
+						
+						compare(grid->Rectangle(ra_min, ra_max, dec_min, dec_max, magnitude), magnitude, [&](const double& _ra, const double& _dec) {
+							
+							const bool ra = ra_min > ra_max ?
+								_ra >= ra_min || _ra <= ra_max :
+								_ra >= ra_min && _ra <= ra_max;
+							
+							return ra && _dec >= dec_min && _dec <= dec_max;
+							
+						}, "Rectangle");
+					}
+				}
+				
+				// A rectangle whose corners are the coordinates of two stars, which therefore lie on its boundary.
+				const auto& a = stars[1U];
+				const auto& b = stars[2U];
+				
+				auto found = grid->Rectangle(std::min(*a.ra, *b.ra), std::max(*a.ra, *b.ra), std::min(*a.dec, *b.dec), std::max(*a.dec, *b.dec));
+				std::sort(found.begin(), found.end());
+				
+				Check(std::binary_search(found.begin(), found.end(), 1U) && std::binary_search(found.begin(), found.end(), 2U), "Rectangle excluded a star on its boundary!");
+			}
+		}
+	}
+	
+	/**
+	 * @brief Checks the lookups of an identifier against a linear scan for the first star with each identifier.
+	 */
+	template <F _Field, typename M>
+	void Identifiers(const ATHYG::IdentifierIndex<V3>& _index, const std::vector<V3>& _stars, M V3::* _member) {
+		
+		using Key = ATHYG::IdentifierIndex<V3>::Key<_Field>;
+		
+		std::unordered_map<Key, size_t> first;
+		std::vector<Key> ids;
+		std::vector<size_t> expected;
+		
+		for (size_t i = 0U; i < _stars.size(); ++i) {
+			
+			const auto& value = _stars[i].*_member;
+			
+			if (value.has_value()) {
+				
+				const auto id = static_cast<Key>(*value);
+				
+				// Empty text is a missing identifier.
+				if constexpr (std::is_same_v<Key, std::string_view>) {
+					if (id.empty()) {
+						continue;
+					}
+				}
+				
+				if (first.emplace(id, i).second) {
+					
+					ids.push_back(id);
+					expected.push_back(i);
+				}
+			}
+		}
+		
+		Check(!ids.empty(), "Dataset contains no identifiers!");
+		
+		for (size_t i = 0U; i < ids.size(); ++i) {
+			Check(_index.Find<_Field>(ids[i]) == expected[i], "Find differs from a linear scan!");
+		}
+		
+		// Identifiers of no star.
+		if constexpr (std::is_same_v<Key, std::string_view>) {
+			ids.insert(ids.begin(), "not-an-identifier");
+		}
+		else {
+			
+			Key missing { 0U };
+			
+			while (first.count(missing) != 0U) {
+				++missing;
+			}
+			
+			ids.insert(ids.begin(), missing);
+		}
+		
+		expected.insert(expected.begin(), ATHYG::IdentifierIndex<V3>::s_NotFound);
+		
+		Check(!_index.Find<_Field>(ids.front()).has_value(), "Find found a missing identifier!");
+		
+		// Reuse the result of a larger lookup.
+		std::vector<size_t> found;
+		
+		_index.Find<_Field>(ids, found);
+		Check(found == expected, "Batched Find differs from a linear scan!");
+		
+		ids.resize(ids.size() / 2U);
+		expected.resize(ids.size());
+		
+		_index.Find<_Field>(ids, found);
+		Check(found == expected, "Batched Find differs from a linear scan when reusing its result!");
+	}
+	
+	void IdentifierIndex() {
+		
+		using Index = ATHYG::IdentifierIndex<V3>;
+		
+		const auto path = Dataset("identifiers.csv");
+		
+		// Every star appears twice, and the first must be found.
+		const std::vector<std::filesystem::path> paths { path, path };
+		
+		const auto stars     = ATHYG::Load<V3>(paths);
+		const auto catalogue = Catalogue::Load(paths);
+		
+		Check(stars.size() == s_Rows * 2U, "Dataset was not loaded twice!");
+		
+		const Index vector(stars);
+		const Index columns(catalogue);
+		
+		for (const auto* const index : { &vector, &columns }) {
+			
+			Identifiers<F::hip >(*index, stars, &V3::hip);
+			Identifiers<F::hd  >(*index, stars, &V3::hd);
+			Identifiers<F::hr  >(*index, stars, &V3::hr);
+			Identifiers<F::gaia>(*index, stars, &V3::gaia);
+			Identifiers<F::tyc >(*index, stars, &V3::tyc);
+		}
+		
+		// Collide the hash of an identifier with another star, which must be skipped by comparing the identifiers.
+		const auto has = [&stars](const size_t& _index) {
+			return stars[_index].tyc.has_value() && !stars[_index].tyc->empty();
+		};
+		
+		size_t a = 0U;
+		
+		while (!has(a)) {
+			++a;
+		}
+		
+		size_t b = a + 1U;
+		
+		while (!has(b) || *stars[b].tyc == *stars[a].tyc) {
+			++b;
+		}
+		
+		for (const auto* const index : { &vector, &columns }) {
+			
+			ATHYGTests::Collide(*index, *stars[a].tyc, b);
+			
+			Check(index->Find<F::tyc>(*stars[a].tyc) == a, "Find returned a star whose identifier only shares its hash!");
+			Check(index->Find<F::tyc>(*stars[b].tyc) == b, "Find did not find the colliding star!");
+			
+			const auto found = index->Find<F::tyc>(std::vector<std::string_view> { *stars[b].tyc, *stars[a].tyc });
+			
+			Check(found == std::vector<size_t> { b, a }, "Batched Find returned a star whose identifier only shares its hash!");
+		}
+		
+		// An identifier excluded by a projection.
+		const auto projected = Catalogue::Load<ATHYG::Projection<V3, F::hip, F::ra, F::dec>>(paths);
+		
+		const Index index(projected);
+		
+		Identifiers<F::hip>(index, stars, &V3::hip);
+		
+		bool threw = false;
+		
+		try {
+			static_cast<void>(index.Find<F::tyc>(*stars[a].tyc));
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		
+		Check(threw, "Find did not throw for an identifier excluded by a projection!");
+	}
+	
+	void MagnitudeOrder() {
+		
+		using Order = ATHYG::MagnitudeOrder<V3>;
+		
+		const std::vector<std::filesystem::path> paths { Dataset("magnitudes.csv") };
+		
+		auto stars = ATHYG::Load<V3>(paths);
+		
+		// Ties, signed zeros, negative magnitudes, and missing magnitudes.
+		for (size_t i = 0U; i < stars.size(); i += 5U) {
+			
+			switch ((i / 5U) % 5U) {
+				case 0U: { stars[i].mag = 5.0;         break; }
+				case 1U: { stars[i].mag = 0.0;         break; }
+				case 2U: { stars[i].mag = -0.0;        break; }
+				case 3U: { stars[i].mag = -1.25;       break; }
+				default: { stars[i].mag = std::nullopt; break; }
+			}
+		}
+		
+		// The order of a stable sort of the magnitudes, at single precision, with missing magnitudes last.
+		const auto expected = [](const std::vector<V3>& _stars) {
+			
+			const auto key = [&_stars](const size_t& _index) {
+				return std::make_pair(!_stars[_index].mag.has_value(), static_cast<float>(_stars[_index].mag.value_or(0.0)));
+			};
+			
+			std::vector<size_t> result(_stars.size());
+			
+			for (size_t i = 0U; i < result.size(); ++i) {
+				result[i] = i;
+			}
+			
+			std::stable_sort(result.begin(), result.end(), [&key](const size_t& _a, const size_t& _b) { return key(_a) < key(_b); });
+			
+			return result;
+		};
+		
+		const auto check = [&expected](const std::vector<V3>& _stars, const Order& _order) {
+			
+			Check(_order.Order() == expected(_stars), "Order differs from a stable sort!");
+			
+			const auto& order   = _order.Order();
+			const auto& offsets = _order.Offsets();
+			
+			size_t known = 0U;
+			
+			for (const auto& star : _stars) {
+				known += star.mag.has_value() ? 1U : 0U;
+			}
+			
+			Check(!offsets.empty() && offsets.front() == 0U && offsets.back() == known, "Offsets do not span the stars with a magnitude!");
+			Check(offsets.size() > 1U && offsets[1U] > 0U, "First bucket does not contain the brightest star!");
+			
+			for (size_t bucket = 0U; bucket + 1U < offsets.size(); ++bucket) {
+				
+				const auto min = static_cast<float>(_order.Base() + (static_cast<double>(bucket)      * _order.Width()));
+				const auto max = static_cast<float>(_order.Base() + (static_cast<double>(bucket + 1U) * _order.Width()));
+				
+				for (auto i = offsets[bucket]; i < offsets[bucket + 1U]; ++i) {
+					
+					const auto magnitude = static_cast<float>(*_stars[order[i]].mag);
+					
+					Check(magnitude >= min && magnitude < max, "Star is not within the range of its bucket!");
+				}
+			}
+			
+			for (const auto& magnitude : { -10.0, -1.25, -0.0, 0.0, 5.0, 6.5, 100.0, std::numeric_limits<double>::infinity() }) {
+				
+				size_t count = 0U;
+				
+				for (const auto& star : _stars) {
+					count += star.mag.has_value() && static_cast<float>(*star.mag) <= static_cast<float>(magnitude) ? 1U : 0U;
+				}
+				
+				Check(_order.Count(magnitude) == count, "Count differs from a linear scan!");
+			}
+			
+			Check(_order.Count(std::numeric_limits<double>::quiet_NaN()) == 0U, "Count included stars for a magnitude of NaN!");
+		};
+		
+		for (const auto& width : { 1.0, 0.5, 0.001 }) {
+			check(stars, Order(stars, width));
+		}
+		
+		ATHYG::Options options;
+		
+		const auto catalogue = Catalogue::Load(paths, options);
+		const auto loaded    = ATHYG::Load<V3>(paths, options);
+		
+		Check(Order(catalogue).Order() == Order(loaded).Order(), "Order of a catalogue differs from the order of its stars!");
+		
+		// Enough stars to be sorted by several threads, in parts which share magnitudes.
+		std::vector<V3> many;
+		many.reserve(stars.size() * 30U);
+		
+		for (size_t copy = 0U; copy < 30U; ++copy) {
+			
+			for (const auto& star : stars) {
+				
+				many.push_back(star);
+				
+				if (many.back().mag.has_value()) {
+					*many.back().mag += static_cast<double>(copy % 3U);
+				}
+			}
+		}
+		
+		check(many, Order(many, 1.0, 4U));
+		
+		// Applying the order moves the stars into it.
+		const Order order(stars);
+		
+		auto applied = stars;
+		order.Apply(applied);
+		
+		for (size_t i = 0U; i < applied.size(); ++i) {
+			Check(Equal(applied[i], stars[order.Order()[i]]), "Apply did not move the stars into order!");
+		}
+		
+		applied.pop_back();
+		
+		bool threw = false;
+		
+		try {
+			order.Apply(applied);
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		
+		Check(threw, "Apply did not throw for a different number of stars!");
+	}
+	
+	void MalformedRows() {
+		
+		using Projection = ATHYG::Projection<V3>;
+		
+		const auto generated = ReadFile(Dataset("generated.csv"));
+		
+		std::vector<std::string> lines;
+		
+		for (size_t begin = 0U; begin < generated.size();) {
+			
+			const auto end = std::min(generated.find('\n', begin), generated.size());
+			
+			lines.push_back(generated.substr(begin, end - begin));
+			
+			begin = end + 1U;
+		}
+		
+		std::vector<std::string> header;
+		
+		for (size_t begin = 0U; begin <= lines.front().size();) {
+			
+			const auto end = std::min(lines.front().find(',', begin), lines.front().size());
+			
+			header.push_back(lines.front().substr(begin, end - begin));
+			
+			begin = end + 1U;
+		}
+		
+		const auto proper = static_cast<size_t>(std::find(header.begin(), header.end(), "proper") - header.begin());
+		
+		Check(proper < header.size(), "Header does not contain proper!");
+		
+		// The same rows with and without malformed rows, some of which follow quoted fields spanning several lines.
+		auto clean     = lines.front() + '\n';
+		auto malformed = clean;
+		
+		std::vector<std::pair<uint64_t, uint64_t>> expected;
+		
+		uint64_t line = 2U;
+		
+		const auto truncate = [](const std::string& _row) {
+			return _row.substr(0U, _row.find(',', _row.size() / 2U));
+		};
+		
+		for (size_t i = 1U; i < lines.size(); ++i) {
+			
+			auto row = lines[i];
+			
+			if (i % 97U == 3U) {
+				
+				size_t begin = 0U;
+				
+				for (size_t field = 0U; field < proper; ++field) {
+					begin = row.find(',', begin) + 1U;
+				}
+				
+				row.replace(begin, row.find(',', begin) - begin, "\"Multi\nline\"");
+			}
+			
+			row += '\n';
+			
+			clean     += row;
+			malformed += row;
+			
+			line += static_cast<uint64_t>(std::count(row.begin(), row.end(), '\n'));
+			
+			if (i % 211U == 5U) {
+				
+				expected.emplace_back(line++, malformed.size());
+				
+				malformed += truncate(lines[i]) + '\n';
+			}
+		}
+		
+		// A malformed last row, without a newline.
+		expected.emplace_back(line, malformed.size());
+		
+		malformed += truncate(lines[1U]);
+		
+		const auto clean_path     = Directory() / "clean.csv";
+		const auto malformed_path = Directory() / "malformed.csv";
+		
+		WriteFile(clean_path,     clean);
+		WriteFile(malformed_path, malformed);
+		
+		const std::vector<std::filesystem::path> paths { malformed_path };
+		
+		const auto stars = ATHYG::Load<V3>({ clean_path });
+		
+		const auto equal = [&stars](const std::vector<V3>& _stars) {
+			
+			if (_stars.size() != stars.size()) {
+				return false;
+			}
+			
+			for (size_t i = 0U; i < stars.size(); ++i) {
+				
+				if (!Equal(_stars[i], stars[i])) {
+					return false;
+				}
+			}
+			
+			return true;
+		};
+		
+		const auto throws = [](const auto& _load) {
+			
+			try {
+				static_cast<void>(_load());
+			}
+			catch (const std::runtime_error&) {
+				return true;
+			}
+			
+			return false;
+		};
+		
+		// Serially, and split into chunks parsed by several threads.
+		for (const auto& [threads, chunk_size] : { std::make_pair(static_cast<size_t>(1U), static_cast<size_t>(4U * 1024U * 1024U)), std::make_pair(static_cast<size_t>(4U), static_cast<size_t>(4096U)) }) {
+			
+			ATHYG::Options options;
+			options.threads    = threads;
+			options.chunk_size = chunk_size;
+			
+			Check(throws([&]() { return ATHYG::Load<V3>(paths, options); }),     "Load did not throw for a malformed row!");
+			Check(throws([&]() { return Catalogue::Load(paths, options); }),     "Catalogue::Load did not throw for a malformed row!");
+			
+			ATHYG::Diagnostics diagnostics;
+			options.diagnostics = &diagnostics;
+			
+			Check(equal(ATHYG::Load<V3, Projection, ATHYG::Errors::Skip>(paths, options)), "Skip did not discard only the malformed rows!");
+			Check(diagnostics.count == expected.size() && diagnostics.entries.empty(), "Skip did not only count the malformed rows!");
+			
+			const auto collect = [&](const size_t& _capacity, const bool& _catalogue) {
+				
+				diagnostics = ATHYG::Diagnostics();
+				diagnostics.capacity = _capacity;
+				
+				const bool loaded = _catalogue ?
+					Equal(Catalogue::Load<Projection, ATHYG::Errors::Collect>(paths, options), stars) :
+					equal(ATHYG::Load<V3, Projection, ATHYG::Errors::Collect>(paths, options));
+				
+				Check(loaded, "Collect did not discard only the malformed rows!");
+				Check(diagnostics.count == expected.size(), "Collect did not count every malformed row!");
+				Check(diagnostics.entries.size() == std::min(_capacity, expected.size()), "Collect did not record the malformed rows up to its capacity!");
+				
+				for (size_t i = 0U; i < diagnostics.entries.size(); ++i) {
+					
+					const auto& entry = diagnostics.entries[i];
+					
+					Check(entry.path == malformed_path && !entry.reason.empty(), "Diagnostic does not describe its file!");
+					Check(entry.line   == expected[i].first,  "Diagnostic is on the wrong line!");
+					Check(entry.offset == expected[i].second, "Diagnostic is at the wrong offset!");
+				}
+			};
+			
+			collect(expected.size(), false);
+			collect(expected.size(), true);
+			collect(3U, false);
+		}
+	}
+	
+	void AsyncFile() {
+		
+		const auto path = Directory() / "async.bin";
+		
+		std::string contents(1024U * 1024U + 123U, '\0');
+		
+		for (size_t i = 0U; i < contents.size(); ++i) {
+			contents[i] = static_cast<char>('a' + (i % 26U));
+		}
+		
+		WriteFile(path, contents);
+		
+		Check(ATHYGTests::Read(path, 4096U, []() {}) == contents, "AsyncFile did not read every block of the file!");
+		
+		WriteFile(path, std::string());
+		
+		Check(ATHYGTests::Read(path, 4096U, []() {}).empty(), "AsyncFile read an empty file!");
+		
+		// Truncating the file once it is open must fail the read rather than end it early.
+		WriteFile(path, contents);
+		
+		bool threw = false;
+		
+		try {
+			static_cast<void>(ATHYGTests::Read(path, 4096U, [&path]() { std::filesystem::resize_file(path, 100U * 1024U); }));
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		
+		Check(threw, "AsyncFile did not throw for a file truncated while it was read!");
+	}
+	
+	/** @brief Every test, by name. */
+	const std::vector<std::pair<std::string_view, std::function<void()>>> s_Tests {
+		{ "HeaderMapping",     HeaderMapping     },
+		{ "CacheHeaderChange", CacheHeaderChange },
+		{ "CacheRoundTrip",    CacheRoundTrip    },
+		{ "CorruptCache",      CorruptCache      },
+		{ "Filter",            Filter            },
+		{ "Reload",            Reload            },
+		{ "Handle",            Handle            },
+		{ "LazyCatalogue",     LazyCatalogue     },
+		{ "Scanner",           Scanner           },
+		{ "KDTree",            KDTree            },
+		{ "SkyGrid",           SkyGrid           },
+		{ "IdentifierIndex",   IdentifierIndex   },
+		{ "MagnitudeOrder",    MagnitudeOrder    },
+		{ "MalformedRows",     MalformedRows     },
+		{ "AsyncFile",         AsyncFile         },
+	};
+
+} // namespace
+
+int main(int _argc, char* _argv[]) {
+	
+	// Run the tests named by the arguments, or every test if there are none.
+	const std::vector<std::string_view> selected(_argv + 1, _argv + _argc);
+	
+	size_t failed = 0U;
+	
+	for (const auto& [name, test] : s_Tests) {
+		
+		if (!selected.empty() && std::find(selected.begin(), selected.end(), name) == selected.end()) {
+			continue;
+		}
+		
+		try {
+			test();
+			std::cout << "[PASS] " << name << '\n';
+		}
+		catch (const std::exception& e) {
+			std::cout << "[FAIL] " << name << ": " << e.what() << '\n';
+			++failed;
+		}
+	}
+	
+	std::filesystem::remove_all(Directory());
+	
+	return failed == 0U ? 0 : 1;
+}